@@ -0,0 +1,96 @@
+#ifndef CPYCPPYY_DISPATCHCACHE_H
+#define CPYCPPYY_DISPATCHCACHE_H
+
+//////////////////////////////////////////////////////////////////////////////
+//                                                                          //
+// DispatchCache                                                            //
+//                                                                          //
+// Per-method cache used by the generated dispatchers for cross-inheritance //
+// to locate the Python override of a virtual method. Results are valid for //
+// as long as the version tag of the Python class is unchanged (i.e. until  //
+// its dictionary, or that of a base, is modified). If the class does not   //
+// override the method, the C++ base can be called without taking the GIL.  //
+//                                                                          //
+//////////////////////////////////////////////////////////////////////////////
+
+// Bindings
+#include "CPyCppyy/CommonDefs.h"
+
+// Standard
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+
+
+namespace CPyCppyy {
+
+class CPYCPPYY_CLASS_EXTERN DispatchCache {
+public:
+// The name is expected to be a string literal; 'base_callable' is false if the
+// C++ base method can not be used in lieu of a Python override (e.g. if it is
+// pure virtual). Construction does not need the GIL.
+    DispatchCache(const char* name, bool base_callable) :
+            fCppName(name), fName(nullptr), fNext(0), fBaseCallable(base_callable) {
+        for (int i = 0; i < kNEntries; ++i) {
+            fCalls[i] = CallEntry{nullptr, 0, nullptr};
+            fBases[i].store(0, std::memory_order_relaxed);
+        }
+    }
+
+    DispatchCache(const DispatchCache&) = delete;
+    DispatchCache& operator=(const DispatchCache&) = delete;
+
+// True if the class of the given Python object does not override the method, in
+// which case the C++ base should be called instead; the GIL is only taken if the
+// class was not seen before, or if it was modified since. Several classes can be
+// tracked at once, as dispatchers are shared between classes.
+    bool UseBase(PyObject* pyself) {
+        unsigned int tag = CurrentTag(Py_TYPE(pyself));
+        if (tag) {
+            for (int i = 0; i < kNEntries; ++i) {
+                uint64_t state = fBases[i].load(std::memory_order_acquire);
+                if ((unsigned int)(state >> 32) == tag)
+                    return state & kUseBase;
+            }
+        }
+        return Resolve(pyself);
+    }
+
+// Call the override with the given (converted) arguments; requires the GIL.
+    PyObject* Call(PyObject* pyself, PyObject* const* args, size_t nargs);
+
+private:
+// Version tags are unique across classes, so a current tag identifies both the
+// class and its state; 0 means that there is no valid tag.
+    static unsigned int CurrentTag(PyTypeObject* pytype) {
+#ifdef Py_TPFLAGS_VALID_VERSION_TAG
+        if (!(pytype->tp_flags & Py_TPFLAGS_VALID_VERSION_TAG))
+            return 0;
+#endif
+        return pytype->tp_version_tag;
+    }
+
+    bool Resolve(PyObject* pyself);
+    PyObject* Update(PyTypeObject* pytype, bool& use_base);
+
+private:
+    enum { kNEntries = 4 };
+    enum { kUseBase = 0x1 };
+
+    struct CallEntry {
+        PyTypeObject* fType;
+        unsigned int  fTag;
+        PyObject*     fFunc;         // borrowed, valid while fTag is current
+    };
+
+    const char*   fCppName;
+    PyObject*     fName;             // interned on first use
+    CallEntry     fCalls[kNEntries]; // only used with the GIL held
+    std::atomic<uint64_t> fBases[kNEntries];   // (tag << 32) | kUseBase, read without GIL
+    int           fNext;             // next entry to replace
+    bool          fBaseCallable;
+};
+
+} // namespace CPyCppyy
+
+#endif // !CPYCPPYY_DISPATCHCACHE_H
@@ -0,0 +1,307 @@
+// Bindings
+#include "CPyCppyy.h"
+#include "Arrow.h"
+#include "TypeManip.h"
+
+// Standard
+#include <limits.h>
+#include <map>
+#include <string.h>
+#include <vector>
+
+
+//= Arrow C Data Interface export ============================================
+// Columns are described by an ArrowSchema and an ArrowArray; both own their
+// children and (if any) the buffers copied for them through private_data, and
+// contiguous primitive columns reference the C++ memory directly, holding a
+// reference to the owning Python object until released by the consumer.
+namespace {
+
+using namespace CPyCppyy::Arrow;
+
+struct SchemaData {
+    std::string               fFormat;
+    std::string               fName;
+    std::vector<ArrowSchema*> fChildren;
+};
+
+struct ArrayData {
+    std::vector<const void*> fBuffers;
+    std::vector<void*>       fOwned;
+    std::vector<ArrowArray*> fChildren;
+    PyObject*                fOwner = nullptr;
+};
+
+//----------------------------------------------------------------------------
+void release_schema(ArrowSchema* schema)
+{
+    SchemaData* sd = (SchemaData*)schema->private_data;
+    for (auto child : sd->fChildren) {
+        if (child->release)
+            child->release(child);
+        delete child;
+    }
+    delete sd;
+    schema->release = nullptr;
+}
+
+void release_array(ArrowArray* array)
+{
+    ArrayData* ad = (ArrayData*)array->private_data;
+    for (auto child : ad->fChildren) {
+        if (child->release)
+            child->release(child);
+        delete child;
+    }
+    for (auto buf : ad->fOwned)
+        free(buf);
+    if (ad->fOwner) {
+    // consumers may release from any thread
+        PyGILState_STATE state = PyGILState_Ensure();
+        Py_DECREF(ad->fOwner);
+        PyGILState_Release(state);
+    }
+    delete ad;
+    array->release = nullptr;
+}
+
+//----------------------------------------------------------------------------
+void init_column(ArrowSchema* schema, ArrowArray* array, const std::string& name, int64_t length)
+{
+// setup empty, but releasable, descriptions so that failures can clean up
+    SchemaData* sd = new SchemaData{};
+    sd->fName = name;
+    memset(schema, 0, sizeof(ArrowSchema));
+    schema->name         = sd->fName.c_str();
+    schema->release      = release_schema;
+    schema->private_data = sd;
+
+    memset(array, 0, sizeof(ArrowArray));
+    array->length        = length;
+    array->release       = release_array;
+    array->private_data  = new ArrayData{};
+}
+
+void set_format(ArrowSchema* schema, const char* fmt)
+{
+    SchemaData* sd = (SchemaData*)schema->private_data;
+    sd->fFormat = fmt;
+    schema->format = sd->fFormat.c_str();
+}
+
+void* add_buffer(ArrowArray* array, size_t sz)
+{
+    ArrayData* ad = (ArrayData*)array->private_data;
+    void* buf = malloc(sz ? sz : 1);
+    if (buf) {
+        ad->fOwned.push_back(buf);
+        ad->fBuffers.push_back(buf);
+    } else
+        PyErr_NoMemory();
+    return buf;
+}
+
+void set_buffers(ArrowArray* array)
+{
+    ArrayData* ad = (ArrayData*)array->private_data;
+    array->n_buffers = (int64_t)ad->fBuffers.size();
+    array->buffers   = ad->fBuffers.data();
+}
+
+//----------------------------------------------------------------------------
+bool is_std_string(const std::string& type)
+{
+    return type == "std::string" || type.rfind("std::basic_string<char>", 0) == 0 ||
+        type.rfind("std::basic_string<char,", 0) == 0;
+}
+
+const char* primitive_format(const std::string& type, size_t& size)
+{
+    static const std::map<std::string, std::pair<const char*, size_t>> sFormats = {
+        {"char",               {"c", sizeof(char)}},
+        {"signed char",        {"c", sizeof(signed char)}},
+        {"int8_t",             {"c", sizeof(int8_t)}},
+        {"unsigned char",      {"C", sizeof(unsigned char)}},
+        {"uint8_t",            {"C", sizeof(uint8_t)}},
+        {"std::byte",          {"C", 1}},
+        {"short",              {"s", sizeof(short)}},
+        {"unsigned short",     {"S", sizeof(unsigned short)}},
+        {"int",                {"i", sizeof(int)}},
+        {"unsigned int",       {"I", sizeof(unsigned int)}},
+        {"long",               {sizeof(long) == 8 ? "l" : "i", sizeof(long)}},
+        {"unsigned long",      {sizeof(long) == 8 ? "L" : "I", sizeof(unsigned long)}},
+        {"long long",          {"l", sizeof(long long)}},
+        {"unsigned long long", {"L", sizeof(unsigned long long)}},
+        {"float",              {"f", sizeof(float)}},
+        {"double",             {"g", sizeof(double)}}
+    };
+
+    auto fmt = sFormats.find(type);
+    if (fmt == sFormats.end())
+        return nullptr;
+    size = fmt->second.second;
+    return fmt->second.first;
+}
+
+//----------------------------------------------------------------------------
+bool build_column(const std::string& cpptype, char* base, size_t stride, int64_t length,
+    PyObject* owner, ArrowSchema* schema, ArrowArray* array, const std::string& name)
+{
+    init_column(schema, array, name, length);
+    ArrayData* ad = (ArrayData*)array->private_data;
+    ad->fBuffers.push_back(nullptr);        // no validity bitmap: no nulls
+
+    const std::string& type = Cppyy::ResolveName(CPyCppyy::TypeManip::remove_const(cpptype));
+
+// bools are bit-packed in Arrow
+    if (type == "bool") {
+        set_format(schema, "b");
+        uint8_t* bits = (uint8_t*)add_buffer(array, (size_t)(length+7)/8);
+        if (!bits) return false;
+        memset(bits, 0, (size_t)(length+7)/8);
+        for (int64_t i = 0; i < length; ++i) {
+            if (*(bool*)(base+i*stride))
+                bits[i/8] |= (uint8_t)(1 << (i%8));
+        }
+        set_buffers(array);
+        return true;
+    }
+
+// numbers: zero-copy if contiguous, gathered otherwise
+    size_t size = 0;
+    if (const char* fmt = primitive_format(type, size)) {
+        set_format(schema, fmt);
+        if (stride == size) {
+            ad->fBuffers.push_back(base);
+            Py_INCREF(owner);
+            ad->fOwner = owner;
+        } else {
+            char* data = (char*)add_buffer(array, (size_t)length*size);
+            if (!data) return false;
+            for (int64_t i = 0; i < length; ++i)
+                memcpy(data+i*size, base+i*stride, size);
+        }
+        set_buffers(array);
+        return true;
+    }
+
+// strings: offsets and characters, filled in a single pass after sizing
+    if (is_std_string(type)) {
+        size_t total = 0;
+        for (int64_t i = 0; i < length; ++i)
+            total += ((std::string*)(base+i*stride))->size();
+
+        bool large = INT32_MAX < total;
+        set_format(schema, large ? "U" : "u");
+        char* offsets = (char*)add_buffer(array, (size_t)(length+1)*(large ? sizeof(int64_t) : sizeof(int32_t)));
+        char* chars   = offsets ? (char*)add_buffer(array, total) : nullptr;
+        if (!chars) return false;
+
+        size_t pos = 0;
+        for (int64_t i = 0; i < length; ++i) {
+            const std::string& s = *(std::string*)(base+i*stride);
+            if (large) ((int64_t*)offsets)[i] = (int64_t)pos;
+            else       ((int32_t*)offsets)[i] = (int32_t)pos;
+            memcpy(chars+pos, s.data(), s.size());
+            pos += s.size();
+        }
+        if (large) ((int64_t*)offsets)[length] = (int64_t)pos;
+        else       ((int32_t*)offsets)[length] = (int32_t)pos;
+        set_buffers(array);
+        return true;
+    }
+
+// structs: one child per data member, at the member's offset
+    Cppyy::TCppScope_t klass = CPyCppyy::TypeManip::compound(type).empty() ? Cppyy::GetScope(type) : 0;
+    if (!klass || Cppyy::IsNamespace(klass) || Cppyy::IsEnum(type)) {
+        PyErr_Format(PyExc_TypeError, "type %s has no Arrow equivalent", type.c_str());
+        return false;
+    }
+
+    if (Cppyy::GetNumBases(klass) != 0) {
+        PyErr_Format(PyExc_TypeError, "can not export %s: derived classes are not supported", type.c_str());
+        return false;
+    }
+
+    set_format(schema, "+s");
+    set_buffers(array);
+
+    SchemaData* sd = (SchemaData*)schema->private_data;
+    for (Cppyy::TCppIndex_t idata = 0; idata < Cppyy::GetNumDatamembers(klass); ++idata) {
+        if (Cppyy::IsStaticData(klass, idata))
+            continue;
+
+        const std::string& mname = Cppyy::GetDatamemberName(klass, idata);
+        if (0 < Cppyy::GetDimensionSize(klass, idata, 0)) {
+            PyErr_Format(PyExc_TypeError, "can not export %s::%s: array members are not supported",
+                type.c_str(), mname.c_str());
+            return false;
+        }
+
+        ArrowSchema* cschema = new ArrowSchema{};
+        ArrowArray*  carray  = new ArrowArray{};
+        sd->fChildren.push_back(cschema);
+        ad->fChildren.push_back(carray);
+        schema->n_children = array->n_children = (int64_t)sd->fChildren.size();
+        schema->children = sd->fChildren.data();
+        array->children  = ad->fChildren.data();
+
+        if (!build_column(Cppyy::GetDatamemberType(klass, idata),
+                base+Cppyy::GetDatamemberOffset(klass, idata), stride, length, owner, cschema, carray, mname))
+            return false;
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------
+void schema_capsule_destructor(PyObject* capsule)
+{
+    ArrowSchema* schema = (ArrowSchema*)PyCapsule_GetPointer(capsule, kSchemaCapsuleName);
+    if (schema && schema->release)
+        schema->release(schema);
+    delete schema;
+}
+
+void array_capsule_destructor(PyObject* capsule)
+{
+    ArrowArray* array = (ArrowArray*)PyCapsule_GetPointer(capsule, kArrayCapsuleName);
+    if (array && array->release)
+        array->release(array);
+    delete array;
+}
+
+} // unnamed namespace
+
+
+//- public API ---------------------------------------------------------------
+PyObject* CPyCppyy::Arrow::ExportColumn(const std::string& type,
+    void* address, size_t stride, int64_t length, PyObject* owner)
+{
+    ArrowSchema* schema = new ArrowSchema{};
+    ArrowArray*  array  = new ArrowArray{};
+    if (!build_column(type, (char*)address, stride, length, owner, schema, array, "")) {
+        schema->release(schema); delete schema;
+        array->release(array);   delete array;
+        return nullptr;
+    }
+
+    PyObject* pyschema = PyCapsule_New(schema, kSchemaCapsuleName, schema_capsule_destructor);
+    if (!pyschema) {
+        schema->release(schema); delete schema;
+        array->release(array);   delete array;
+        return nullptr;
+    }
+
+    PyObject* pyarray = PyCapsule_New(array, kArrayCapsuleName, array_capsule_destructor);
+    if (!pyarray) {
+        Py_DECREF(pyschema);
+        array->release(array); delete array;
+        return nullptr;
+    }
+
+    PyObject* result = PyTuple_New(2);
+    PyTuple_SET_ITEM(result, 0, pyschema);
+    PyTuple_SET_ITEM(result, 1, pyarray);
+    return result;
+}
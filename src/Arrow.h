@@ -0,0 +1,56 @@
+#ifndef CPYCPPYY_ARROW_H
+#define CPYCPPYY_ARROW_H
+
+// Standard
+#include <stdint.h>
+#include <string>
+
+
+namespace CPyCppyy {
+
+/** ABI of the Arrow C Data Interface, as exchanged through the "arrow_schema"
+    and "arrow_array" capsules of the Arrow PyCapsule interface; see
+    https://arrow.apache.org/docs/format/CDataInterface.html
+ */
+
+namespace Arrow {
+
+struct ArrowSchema {
+    const char*   format;
+    const char*   name;
+    const char*   metadata;
+    int64_t       flags;
+    int64_t       n_children;
+    ArrowSchema** children;
+    ArrowSchema*  dictionary;
+    void        (*release)(ArrowSchema*);
+    void*         private_data;
+};
+
+struct ArrowArray {
+    int64_t      length;
+    int64_t      null_count;
+    int64_t      offset;
+    int64_t      n_buffers;
+    int64_t      n_children;
+    const void** buffers;
+    ArrowArray** children;
+    ArrowArray*  dictionary;
+    void       (*release)(ArrowArray*);
+    void*        private_data;
+};
+
+static const char* const kSchemaCapsuleName = "arrow_schema";
+static const char* const kArrayCapsuleName  = "arrow_array";
+
+// Export 'length' elements of C++ type 'type', starting at 'address' and spaced
+// 'stride' bytes apart, as a (schema, array) tuple of capsules. Contiguous
+// primitive columns are not copied and keep 'owner' alive instead.
+PyObject* ExportColumn(const std::string& type,
+    void* address, size_t stride, int64_t length, PyObject* owner);
+
+} // namespace Arrow
+
+} // namespace CPyCppyy
+
+#endif // !CPYCPPYY_ARROW_H
@@ -8,6 +8,7 @@
 #include "LowLevelViews.h"
 #include "ProxyWrappers.h"
 #include "PyStrings.h"
+#include "ReflectionCache.h"
 #include "TypeManip.h"
 #include "Utility.h"
 
@@ -34,16 +35,10 @@ static PyObject* dm_get(CPPDataMember* dm, CPPInstance* pyobj, PyObject* /* kls
 {
 // cache lookup for low level views
     if (pyobj && dm->fFlags & kIsCachable) {
-        CPyCppyy::CI_DatamemberCache_t& cache = pyobj->GetDatamemberCache();
-        for (auto it = cache.begin(); it != cache.end(); ++it) {
-            if (it->first == dm->fOffset) {
-                if (it->second) {
-                    Py_INCREF(it->second);
-                    return it->second;
-                } else
-                    cache.erase(it);
-                break;
-            }
+        PyObject* cached = pyobj->GetCachedDatamember(dm);
+        if (cached) {
+            Py_INCREF(cached);
+            return cached;
         }
     }
 
@@ -97,9 +92,9 @@ static PyObject* dm_get(CPPDataMember* dm, CPPInstance* pyobj, PyObject* /* kls
 
     // low level views are expensive to create, so cache them on the object instead
         bool isLLView = LowLevelView_CheckExact(result);
-        if (isLLView && CPPInstance_Check(pyobj)) {
+        if (isLLView && 0 <= dm->fCacheSlot && CPPInstance_Check(pyobj)) {
             Py_INCREF(result);
-            pyobj->GetDatamemberCache().push_back(std::make_pair(dm->fOffset, result));
+            pyobj->SetCachedDatamember(dm, result);
             dm->fFlags |= kIsCachable;
         }
 
@@ -149,16 +144,8 @@ static int dm_set(CPPDataMember* dm, CPPInstance* pyobj, PyObject* value)
     }
 
 // remove cached low level view, if any (will be restored upon reaeding)
-    if (dm->fFlags & kIsCachable) {
-        CPyCppyy::CI_DatamemberCache_t& cache = pyobj->GetDatamemberCache();
-        for (auto it = cache.begin(); it != cache.end(); ++it) {
-            if (it->first == dm->fOffset) {
-                Py_XDECREF(it->second);
-                cache.erase(it);
-                break;
-            }
-        }
-    }
+    if (dm->fFlags & kIsCachable)
+        pyobj->SetCachedDatamember(dm, nullptr);
 
     intptr_t address = (intptr_t)dm->GetAddress(pyobj);
     if (!address || address == -1 /* Cling error */)
@@ -193,6 +180,7 @@ static CPPDataMember* dm_new(PyTypeObject* pytype, PyObject*, PyObject*)
     dm->fEnclosingScope = 0;
     dm->fDescription    = nullptr;
     dm->fDoc            = nullptr;
+    dm->fCacheSlot      = -1;
 
     new (&dm->fFullType) std::string{};
 
@@ -323,11 +311,11 @@ void CPyCppyy::CPPDataMember::Set(Cppyy::TCppScope_t scope, Cppyy::TCppIndex_t i
 {
     fEnclosingScope = scope;
     fOffset         = Cppyy::GetDatamemberOffset(scope, idata); // TODO: make lazy
-    fFlags          = Cppyy::IsStaticData(scope, idata) ? kIsStaticData : 0;
+    fFlags          = ReflectionCache::IsStaticData(scope, idata) ? kIsStaticData : 0;
 
     std::vector<dim_t> dims;
     int ndim = 0; Py_ssize_t size = 0;
-    while (0 < (size = Cppyy::GetDimensionSize(scope, idata, ndim))) {
+    while (0 < (size = ReflectionCache::GetDimensionSize(scope, idata, ndim))) {
          ndim += 1;
          if (size == INT_MAX)      // meaning: incomplete array type
              size = UNKNOWN_SIZE;
@@ -337,9 +325,9 @@ void CPyCppyy::CPPDataMember::Set(Cppyy::TCppScope_t scope, Cppyy::TCppIndex_t i
     if (!dims.empty())
         fFlags |= kIsArrayType;
 
-    const std::string name = Cppyy::GetDatamemberName(scope, idata);
-    fFullType = Cppyy::GetDatamemberType(scope, idata);
-    if (Cppyy::IsEnumData(scope, idata)) {
+    const std::string name = ReflectionCache::GetDatamemberName(scope, idata);
+    fFullType = ReflectionCache::GetDatamemberType(scope, idata);
+    if (ReflectionCache::IsEnumData(scope, idata)) {
         if (fFullType.find("(anonymous)") == std::string::npos &&
             fFullType.find("(unnamed)")   == std::string::npos) {
         // repurpose fDescription for lazy lookup of the enum later
@@ -348,7 +336,7 @@ void CPyCppyy::CPPDataMember::Set(Cppyy::TCppScope_t scope, Cppyy::TCppIndex_t i
         }
         fFullType = Cppyy::ResolveEnum(fFullType);
         fFlags |= kIsConstData;
-    } else if (Cppyy::IsConstData(scope, idata)) {
+    } else if (ReflectionCache::IsConstData(scope, idata)) {
         fFlags |= kIsConstData;
     }
 
@@ -419,6 +407,17 @@ void* CPyCppyy::CPPDataMember::GetAddress(CPPInstance* pyobj)
 }
 
 
+//-----------------------------------------------------------------------------
+bool CPyCppyy::CPPDataMember::MayCache()
+{
+// Instance data of array or pointer type is returned as a low level view, which
+// gets cached on the instance, so needs a slot reserved in the class
+    if (fFlags & (kIsStaticData | kIsEnumPrep | kIsEnumType))
+        return false;
+    return (fFlags & kIsArrayType) || (!fFullType.empty() && fFullType.back() == '*');
+}
+
+
 //-----------------------------------------------------------------------------
 std::string CPyCppyy::CPPDataMember::GetName()
 {
@@ -19,6 +19,7 @@ public:
 
     std::string GetName();
     void* GetAddress(CPPInstance* pyobj /* owner */);
+    bool MayCache();
 
 public:                 // public, as the python C-API works with C structs
     PyObject_HEAD
@@ -28,6 +29,7 @@ public:                 // public, as the python C-API works with C structs
     Cppyy::TCppScope_t fEnclosingScope;
     PyObject*          fDescription;
     PyObject*          fDoc;
+    int                fCacheSlot;      // index in instance cache, or -1
 
     // TODO: data members should have a unique identifier, just like methods,
     // so that reflection information can be recovered post-initialization
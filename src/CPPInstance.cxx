@@ -1,6 +1,7 @@
 // Bindings
 #include "CPyCppyy.h"
 #include "CPPInstance.h"
+#include "CPPDataMember.h"
 #include "CPPScope.h"
 #include "CPPOverload.h"
 #include "MemoryRegulator.h"
@@ -55,6 +56,9 @@ struct ExtendedData {
         for (auto& pc : fDatamemberCache)
             Py_XDECREF(pc.second);
         fDatamemberCache.clear();
+        for (auto& ps : fDatamemberSlots)
+            Py_XDECREF(ps.second);
+        fDatamemberSlots.clear();
     }
 
 // the original object reference it replaces (Note: has to be first data member, see usage
@@ -64,6 +68,9 @@ struct ExtendedData {
 // for caching expensive-to-create data member representations
     CPyCppyy::CI_DatamemberCache_t fDatamemberCache;
 
+// for caching low level views of data members, indexed by the member's slot
+    CPyCppyy::CI_DatamemberSlots_t fDatamemberSlots;
+
 // for smart pointer types
     CPyCppyy::CPPSmartClass* fSmartClass;
 
@@ -78,6 +85,7 @@ struct ExtendedData {
 
 #define EXT_OBJECT(pyobj)  ((ExtendedData*)((pyobj)->fObject))->fObject
 #define DATA_CACHE(pyobj)  ((ExtendedData*)((pyobj)->fObject))->fDatamemberCache
+#define DATA_SLOTS(pyobj)  ((ExtendedData*)((pyobj)->fObject))->fDatamemberSlots
 #define SMART_CLS(pyobj)   ((ExtendedData*)((pyobj)->fObject))->fSmartClass
 #define SMART_TYPE(pyobj)  SMART_CLS(pyobj)->fCppType
 #define DISPATCHPTR(pyobj) ((ExtendedData*)((pyobj)->fObject))->fDispatchPtr
@@ -195,6 +203,51 @@ CPyCppyy::CI_DatamemberCache_t& CPyCppyy::CPPInstance::GetDatamemberCache()
     return DATA_CACHE(this);
 }
 
+//----------------------------------------------------------------------------
+PyObject* CPyCppyy::CPPInstance::GetCachedDatamember(CPPDataMember* dm)
+{
+// Return the cached representation of data member dm, if any (borrowed reference)
+    if (!IsExtended() || dm->fCacheSlot < 0)
+        return nullptr;
+
+    CI_DatamemberSlots_t& slots = DATA_SLOTS(this);
+    if ((size_t)dm->fCacheSlot < slots.size()) {
+        CI_DatamemberSlots_t::value_type& entry = slots[dm->fCacheSlot];
+    // slots of data members from different bases may overlap with multiple inheritance
+        if (entry.first == dm)
+            return entry.second;
+    }
+
+    return nullptr;
+}
+
+//----------------------------------------------------------------------------
+void CPyCppyy::CPPInstance::SetCachedDatamember(CPPDataMember* dm, PyObject* value)
+{
+// Store (steals reference) or, if value is null, clear the representation of dm
+    if (dm->fCacheSlot < 0 || (!value && !IsExtended())) {
+        Py_XDECREF(value);
+        return;
+    }
+
+    CreateExtension();
+    CI_DatamemberSlots_t& slots = DATA_SLOTS(this);
+    if (slots.size() <= (size_t)dm->fCacheSlot) {
+    // lazy allocation, sized for all data members of the class in one go
+        if (!value) return;
+        int nslots = ((CPPScope*)Py_TYPE(this))->fNDatamemberSlots;
+        slots.resize(std::max(nslots, dm->fCacheSlot+1), std::make_pair(nullptr, nullptr));
+    }
+
+    CI_DatamemberSlots_t::value_type& entry = slots[dm->fCacheSlot];
+    PyObject* old = entry.second;
+    if (value || entry.first == dm) {
+        entry.first  = value ? dm : nullptr;
+        entry.second = value;
+        Py_XDECREF(old);
+    }
+}
+
 //----------------------------------------------------------------------------
 void CPyCppyy::CPPInstance::SetDispatchPtr(void* ptr)
 {
@@ -386,6 +439,37 @@ static PyObject* op_item(CPPInstance* self, Py_ssize_t idx)
     return BindCppObjectNoCast(indexed_obj, ((CPPClass*)Py_TYPE(self))->fCppType, flags);
 }
 
+//----------------------------------------------------------------------------
+static PyObject* op_dir(PyObject* self)
+{
+// the class listing includes methods not yet created; add instance attributes
+    PyObject* dirlist = PyObject_Dir((PyObject*)Py_TYPE(self));
+    if (!dirlist)
+        return nullptr;
+
+    PyObject* dct = PyObject_GetAttr(self, PyStrings::gDict);
+    if (!dct) {
+        PyErr_Clear();
+        return dirlist;
+    }
+
+    PyObject* names = PySet_New(dirlist);
+    Py_DECREF(dirlist);
+    PyObject* keys = names ? PyMapping_Keys(dct) : nullptr;
+    Py_DECREF(dct);
+    if (!keys) {
+        Py_XDECREF(names);
+        return nullptr;
+    }
+    for (Py_ssize_t i = 0; i < PyList_GET_SIZE(keys); ++i)
+        PySet_Add(names, PyList_GET_ITEM(keys, i));
+    Py_DECREF(keys);
+
+    dirlist = PySequence_List(names);
+    Py_DECREF(names);
+    return dirlist;
+}
+
 //- sequence methods --------------------------------------------------------
 static PySequenceMethods op_as_sequence = {
     0,                             // sq_length
@@ -411,6 +495,8 @@ static PyMethodDef op_methods[] = {
       (char*)"get associated smart pointer, if any"},
     {(char*)"__reshape__",  (PyCFunction)op_reshape, METH_O,
         (char*)"cast pointer to 1D array type"},
+    {(char*)"__dir__",      (PyCFunction)op_dir, METH_NOARGS,
+        (char*)"list attributes, including methods not yet created"},
     {(char*)nullptr, nullptr, 0, nullptr}
 };
 
@@ -418,7 +504,10 @@ static PyMethodDef op_methods[] = {
 //= CPyCppyy object proxy construction/destruction ===========================
 static CPPInstance* op_new(PyTypeObject* subtype, PyObject*, PyObject*)
 {
-// Create a new object proxy (holder only).
+// Create a new object proxy (holder only); instance lookups use the generic
+// getattr, so methods that were deferred need to exist from here on
+    MaterializeMethods((PyObject*)subtype);
+
     CPPInstance* pyobj = (CPPInstance*)subtype->tp_alloc(subtype, 0);
     pyobj->fObject = nullptr;
     pyobj->fFlags = CPPInstance::kNoWrapConv;
@@ -21,7 +21,10 @@
 
 namespace CPyCppyy {
 
+class CPPDataMember;
+
 typedef std::vector<std::pair<ptrdiff_t, PyObject*>> CI_DatamemberCache_t;
+typedef std::vector<std::pair<CPPDataMember*, PyObject*>> CI_DatamemberSlots_t;
 
 class CPPInstance {
 public:
@@ -70,6 +73,8 @@ public:
 
 // data member cache
     CI_DatamemberCache_t& GetDatamemberCache();
+    PyObject* GetCachedDatamember(CPPDataMember* dm);
+    void SetCachedDatamember(CPPDataMember* dm, PyObject* value);
 
 // smart pointer management
     void SetSmart(PyObject* smart_type);
@@ -7,6 +7,7 @@
 #include "Executors.h"
 #include "ProxyWrappers.h"
 #include "PyStrings.h"
+#include "ReflectionCache.h"
 #include "TypeManip.h"
 #include "SignalTryCatch.h"
 #include "Utility.h"
@@ -232,12 +233,12 @@ inline PyObject* CPyCppyy::CPPMethod::ExecuteProtected(
 bool CPyCppyy::CPPMethod::InitConverters_()
 {
 // build buffers for argument dispatching
-    const size_t nArgs = Cppyy::GetMethodNumArgs(fMethod);
+    const size_t nArgs = ReflectionCache::GetMethodNumArgs(fMethod);
     fConverters.resize(nArgs);
 
 // setup the dispatch cache
     for (int iarg = 0; iarg < (int)nArgs; ++iarg) {
-        const std::string& fullType = Cppyy::GetMethodArgType(fMethod, iarg);
+        const std::string& fullType = ReflectionCache::GetMethodArgType(fMethod, iarg);
         Converter* conv = CreateConverter(fullType);
         if (!conv) {
             PyErr_Format(PyExc_TypeError, "argument type %s not handled", fullType.c_str());
@@ -255,7 +256,7 @@ bool CPyCppyy::CPPMethod::InitExecutor_(Executor*& executor, CallContext* /* ctx
 {
 // install executor conform to the return type
     executor = CreateExecutor(
-        (bool)fMethod == true ? Cppyy::GetMethodResultType(fMethod) \
+        (bool)fMethod == true ? ReflectionCache::GetMethodResultType(fMethod) \
                               : Cppyy::GetScopedFinalName(fScope));
 
     if (!executor)
@@ -749,7 +750,7 @@ bool CPyCppyy::CPPMethod::Initialize(CallContext* ctxt)
         return false;
 
 // minimum number of arguments when calling
-    fArgsRequired = (int)((bool)fMethod == true ? Cppyy::GetMethodReqArgs(fMethod) : 0);
+    fArgsRequired = (int)((bool)fMethod == true ? ReflectionCache::GetMethodReqArgs(fMethod) : 0);
 
     return true;
 }
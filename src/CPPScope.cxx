@@ -63,6 +63,80 @@ static inline PyObject* add_template(PyObject* pyclass,
     return nullptr;       // so that caller caches the method on full name
 }
 
+//----------------------------------------------------------------------------
+static bool add_record_format(Cppyy::TCppScope_t klass, std::string& fmt)
+{
+// Describe the layout of a standard-layout class as a PEP 3118 struct, using the
+// data member offsets for explicit padding; fails on any member (or base) that
+// has no buffer protocol equivalent.
+    static const std::map<std::string, const char*> sTypeCodes = {
+        {"bool", "?"}, {"char", "b"}, {"signed char", "b"}, {"unsigned char", "B"},
+        {"std::byte", "B"}, {"short", "h"}, {"unsigned short", "H"}, {"int", "i"},
+        {"unsigned int", "I"}, {"long", "l"}, {"unsigned long", "L"}, {"long long", "q"},
+        {"unsigned long long", "Q"}, {"float", "f"}, {"double", "d"}, {"long double", "g"},
+        {"std::complex<float>", "Zf"}, {"std::complex<double>", "Zd"}
+    };
+
+    if (!klass || Cppyy::GetNumBases(klass) != 0 || Cppyy::HasVirtualDestructor(klass))
+        return false;
+
+    fmt.append("T{");
+    intptr_t pos = 0;
+    for (Cppyy::TCppIndex_t idata = 0; idata < Cppyy::GetNumDatamembers(klass); ++idata) {
+        if (Cppyy::IsStaticData(klass, idata))
+            continue;
+
+        intptr_t offset = Cppyy::GetDatamemberOffset(klass, idata);
+        if (offset < pos)
+            return false;        // unions, bit fields, etc.
+        if (pos < offset)
+            fmt.append(std::to_string(offset-pos)).append("x");
+
+    // fixed size arrays become sub-arrays of the element type
+        std::string mtype = Cppyy::GetDatamemberType(klass, idata);
+        std::string shape;
+        size_t nelems = 1;
+        int ndim = 0, size = 0;
+        while (0 < (size = Cppyy::GetDimensionSize(klass, idata, ndim))) {
+            if (size == INT_MAX)
+                return false;    // incomplete array type
+            shape.append(ndim++ ? "," : "(").append(std::to_string(size));
+            nelems *= (size_t)size;
+        }
+        if (ndim) {
+            fmt.append(shape).append(")");
+            mtype = mtype.substr(0, mtype.find('['));
+        }
+
+        mtype = Cppyy::ResolveName(TypeManip::remove_const(mtype));
+        size_t msize = 0;
+        auto code = sTypeCodes.find(mtype);
+        if (code != sTypeCodes.end()) {
+            fmt.append(code->second);
+            msize = Cppyy::SizeOf(mtype);
+        } else if (Cppyy::IsEnumData(klass, idata) || TypeManip::compound(mtype) != "") {
+            return false;
+        } else {
+            Cppyy::TCppScope_t mklass = Cppyy::GetScope(mtype);
+            if (!add_record_format(mklass, fmt))
+                return false;
+            msize = Cppyy::SizeOf(mklass);
+        }
+
+        fmt.append(":").append(Cppyy::GetDatamemberName(klass, idata)).append(":");
+        pos = offset + (intptr_t)(nelems*msize);
+    }
+
+    intptr_t sz = (intptr_t)Cppyy::SizeOf(klass);
+    if (sz < pos)
+        return false;
+    if (pos < sz)
+        fmt.append(std::to_string(sz-pos)).append("x");
+    fmt.append("}");
+
+    return true;
+}
+
 
 //= CPyCppyy type proxy construction/destruction =============================
 static PyObject* meta_alloc(PyTypeObject* meta, Py_ssize_t nitems)
@@ -84,6 +158,9 @@ static void meta_dealloc(CPPScope* scope)
     }
     delete scope->fOperators;
     free(scope->fModuleName);
+    free(scope->fRecordFormat);
+    delete scope->fLazyMethods;
+    delete scope->fMissing;
     return PyType_Type.tp_dealloc((PyObject*)scope);
 }
 
@@ -217,6 +294,23 @@ static PyObject* pt_new(PyTypeObject* subtype, PyObject* args, PyObject* kwds)
     result->fFlags      = CPPScope::kNone;
     result->fOperators  = nullptr;
     result->fModuleName = nullptr;
+    result->fRecordFormat = nullptr;
+    result->fLazyMethods = nullptr;
+    result->fMissing = nullptr;
+    result->fMissingGeneration = 0;
+
+// data member cache slots are numbered per class, continuing from the bases
+    result->fNDatamemberSlots = 0;
+    if (2 <= PyTuple_GET_SIZE(args) && PyTuple_Check(PyTuple_GET_ITEM(args, 1))) {
+        PyObject* pybases = PyTuple_GET_ITEM(args, 1);
+        for (Py_ssize_t ibase = 0; ibase < PyTuple_GET_SIZE(pybases); ++ibase) {
+            PyObject* pybase = PyTuple_GET_ITEM(pybases, ibase);
+            if (pybase == (PyObject*)&CPPInstance_Type || !CPPScope_Check(pybase))
+                continue;
+            if (result->fNDatamemberSlots < ((CPPScope*)pybase)->fNDatamemberSlots)
+                result->fNDatamemberSlots = ((CPPScope*)pybase)->fNDatamemberSlots;
+        }
+    }
 
     if (raw && deref) {
         result->fFlags |= CPPScope::kIsSmart;
@@ -249,6 +343,8 @@ static PyObject* pt_new(PyTypeObject* subtype, PyObject* args, PyObject* kwds)
                 result->fFlags |= CPPScope::kIsPython;
                 if (1 < PyTuple_GET_SIZE(PyTuple_GET_ITEM(args, 1)))
                     result->fFlags |= CPPScope::kIsMultiCross;
+            // lookups through super() and the dispatchers bypass the C++ bases' getattr
+                MaterializeMethods((PyObject*)result);
                 std::ostringstream errmsg;
                 if (!InsertDispatcher(result, PyTuple_GET_ITEM(args, 1), dct, errmsg)) {
                     PyErr_Format(PyExc_TypeError, "no python-side overrides supported (%s)", errmsg.str().c_str());
@@ -302,6 +398,66 @@ static PyObject* pt_new(PyTypeObject* subtype, PyObject* args, PyObject* kwds)
 }
 
 
+//----------------------------------------------------------------------------
+// Names that could not be found through the backend are remembered per scope, as
+// repeated probes (hasattr, duck-typing, pickle) are expensive; all such entries
+// are dropped when new code is loaded, by bumping the generation. Only the code
+// compiled through the bindings does so automatically, hence this is opt-in.
+static bool     gLookupCache      = false;
+static uint32_t gLookupGeneration = 1;
+static struct {
+    Py_ssize_t fHits;
+    Py_ssize_t fMisses;
+    Py_ssize_t fInvalidations;
+} gLookupStats = {0, 0, 0};
+
+static bool is_known_missing(CPPScope* klass, const std::string& name)
+{
+    if (!gLookupCache || !klass->fMissing)
+        return false;
+    if (klass->fMissingGeneration != gLookupGeneration) {
+        klass->fMissing->clear();
+        klass->fMissingGeneration = gLookupGeneration;
+        return false;
+    }
+    return klass->fMissing->find(name) != klass->fMissing->end();
+}
+
+static void add_missing(CPPScope* klass, const std::string& name)
+{
+// template instantiations may succeed later even without new code being loaded
+    if (!gLookupCache || name.find('<') != std::string::npos)
+        return;
+    if (!klass->fMissing)
+        klass->fMissing = new NameSet_t;
+    if (klass->fMissingGeneration != gLookupGeneration) {
+        klass->fMissing->clear();
+        klass->fMissingGeneration = gLookupGeneration;
+    }
+    klass->fMissing->insert(name);
+    gLookupStats.fMisses += 1;
+}
+
+bool SetLookupCache(bool enable)
+{
+    bool old = gLookupCache;
+    gLookupCache = enable;
+    if (!enable) InvalidateLookupCache();
+    return old;
+}
+
+void InvalidateLookupCache()
+{
+    gLookupGeneration += 1;
+    gLookupStats.fInvalidations += 1;
+}
+
+PyObject* GetLookupCacheStats()
+{
+    return Py_BuildValue("{s:n,s:n,s:n}", "hits", gLookupStats.fHits,
+        "misses", gLookupStats.fMisses, "invalidations", gLookupStats.fInvalidations);
+}
+
 //----------------------------------------------------------------------------
 static PyObject* meta_getattro(PyObject* pyclass, PyObject* pyname)
 {
@@ -342,6 +498,28 @@ static PyObject* meta_getattro(PyObject* pyclass, PyObject* pyname)
             name.compare(name.size()-2, name.size(), "__") == 0)
         return possibly_shadowed;
 
+// methods that were deferred when building the class
+    if (MaterializeMethod(pyclass, name)) {
+        attr = PyType_Type.tp_getattro(pyclass, pyname);
+        if (attr) {
+            Py_XDECREF(possibly_shadowed);
+            return attr;
+        }
+    }
+
+// names that were not found before, with no code loaded since, fail immediately
+    if (is_known_missing((CPPScope*)pyclass, name)) {
+        gLookupStats.fHits += 1;
+        if (possibly_shadowed) {
+            PyErr_Clear();
+            PyType_Type.tp_setattro(pyclass, pyname, possibly_shadowed);
+            return possibly_shadowed;
+        }
+        PyErr_Format(PyExc_AttributeError, "%s has no attribute \'%s\'",
+            ((PyTypeObject*)pyclass)->tp_name, name.c_str());
+        return nullptr;
+    }
+
 // more elaborate search in case of failure (eg. for inner classes on demand)
     std::vector<Utility::PyError_t> errors;
     Utility::FetchError(errors);
@@ -519,6 +697,10 @@ static PyObject* meta_getattro(PyObject* pyclass, PyObject* pyname)
                 CPyCppyy_PyText_AsString(pyname));
         }
         SetDetailedException(errors, topmsg /* steals */, PyExc_AttributeError /* default error */);
+
+    // only remember true lookup failures, not e.g. failed template instantiations
+        if (PyErr_ExceptionMatches(PyExc_AttributeError))
+            add_missing(klass, name);
     }
 
     return attr;
@@ -542,6 +724,14 @@ static int meta_setattro(PyObject* pyclass, PyObject* pyname, PyObject* pyval)
         }
     }
 
+// a deferred method that is replaced or deleted must not be created later on; as
+// it would have been in the class dictionary, deleting it succeeds
+    LazyMethods_t* pending = ((CPPScope*)pyclass)->fLazyMethods;
+    if (pending && CPyCppyy_PyText_Check(pyname) && pending->erase(CPyCppyy_PyText_AsString(pyname))) {
+        if (!pyval && !PyDict_GetItem(((PyTypeObject*)pyclass)->tp_dict, pyname))
+            return 0;
+    }
+
     return PyType_Type.tp_setattro(pyclass, pyname, pyval);
 }
 
@@ -596,8 +786,28 @@ static PyObject* meta_dir(CPPScope* klass)
     }
 
     PyObject* dirlist = _generic_dir((PyObject*)klass);
-    if (!(klass->fFlags & CPPScope::kIsNamespace))
+    if (!(klass->fFlags & CPPScope::kIsNamespace)) {
+    // add methods that have not been created yet
+        PyObject* mro = ((PyTypeObject*)klass)->tp_mro;
+        PyObject* names = nullptr;
+        for (Py_ssize_t i = 0; dirlist && mro && i < PyTuple_GET_SIZE(mro); ++i) {
+            CPPScope* base = (CPPScope*)PyTuple_GET_ITEM(mro, i);
+            if ((void*)base == (void*)&CPPInstance_Type || !CPPScope_Check(base) || !base->fLazyMethods)
+                continue;
+            if (!names) names = PySet_New(dirlist);
+            for (const auto& lm : *base->fLazyMethods) {
+                PyObject* pyname = CPyCppyy_PyText_FromString(lm.first.c_str());
+                PySet_Add(names, pyname);
+                Py_DECREF(pyname);
+            }
+        }
+        if (names) {
+            Py_DECREF(dirlist);
+            dirlist = PySequence_List(names);
+            Py_DECREF(names);
+        }
         return dirlist;
+    }
 
     std::set<std::string> cppnames;
     Cppyy::GetAllCppNames(klass->fCppType, cppnames);
@@ -715,3 +925,24 @@ PyTypeObject CPPScope_Type = {
 };
 
 } // namespace CPyCppyy
+
+
+//----------------------------------------------------------------------------
+const char* CPyCppyy::CPPScope::GetRecordFormat()
+{
+// Return the PEP 3118 format of instances of this class, for exporting arrays of
+// them as record buffers; null if not representable. The result is cached, with
+// an empty string marking classes that were found not to be representable.
+    if (!fRecordFormat) {
+        std::string fmt;
+        if (!(fFlags & (kIsNamespace | kIsPython)) && fCppType) {
+            fmt = "^";           // native sizes, padding is explicit
+            if (!add_record_format(fCppType, fmt))
+                fmt.clear();
+        }
+        fRecordFormat = (char*)malloc(fmt.size()+1);
+        memcpy(fRecordFormat, fmt.c_str(), fmt.size()+1);
+    }
+
+    return *fRecordFormat ? fRecordFormat : nullptr;
+}
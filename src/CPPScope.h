@@ -20,6 +20,9 @@ typedef struct {
 
 // Standard
 #include <map>
+#include <string>
+#include <unordered_set>
+#include <vector>
 
 
 namespace CPyCppyy {
@@ -32,6 +35,8 @@ namespace CPyCppyy {
  */
 
 typedef std::map<Cppyy::TCppObject_t, PyObject*> CppToPyMap_t;
+typedef std::map<std::string, std::vector<Cppyy::TCppIndex_t>> LazyMethods_t;
+typedef std::unordered_set<std::string> NameSet_t;
 namespace Utility { struct PyOperators; }
 
 class CPPScope {
@@ -60,6 +65,14 @@ public:
     } fImp;
     Utility::PyOperators*       fOperators;
     char*             fModuleName;
+    int               fNDatamemberSlots;     // cache slots taken by data members
+    char*             fRecordFormat;         // PEP 3118 struct format (lazy)
+    LazyMethods_t*    fLazyMethods;          // methods recorded, but not yet created
+    NameSet_t*        fMissing;              // names known to be absent (lookup cache)
+    uint32_t          fMissingGeneration;    // code loading generation of fMissing
+
+public:
+    const char* GetRecordFormat();
 
 private:
     CPPScope() = delete;
@@ -93,6 +106,13 @@ inline bool CPPScope_CheckExact(T* object)
     return object && Py_TYPE(object) == &CPPScope_Type;
 }
 
+//- negative lookup cache ----------------------------------------------------
+// names that were not found on a scope are remembered until new code is loaded;
+// off by default, as code loaded from outside the bindings must be signaled
+bool SetLookupCache(bool enable);
+void InvalidateLookupCache();
+PyObject* GetLookupCacheStats();
+
 //- creation -----------------------------------------------------------------
 inline CPPScope* CPPScopeMeta_New(Cppyy::TCppScope_t klass, PyObject* args)
 {
@@ -106,6 +126,11 @@ inline CPPScope* CPPScopeMeta_New(Cppyy::TCppScope_t klass, PyObject* args)
     pymeta->fImp.fCppObjects = nullptr;
     pymeta->fOperators       = nullptr;
     pymeta->fModuleName      = nullptr;
+    pymeta->fNDatamemberSlots = 0;
+    pymeta->fRecordFormat    = nullptr;
+    pymeta->fLazyMethods     = nullptr;
+    pymeta->fMissing         = nullptr;
+    pymeta->fMissingGeneration = 0;
 
     return pymeta;
 }
@@ -8,12 +8,15 @@
 #include "CPPOverload.h"
 #include "CPPScope.h"
 #include "CustomPyTypes.h"
+#include "Dispatcher.h"
 #include "LowLevelViews.h"
 #include "MemoryRegulator.h"
 #include "ProxyWrappers.h"
 #include "PyStrings.h"
+#include "ReflectionCache.h"
 #include "TemplateProxy.h"
 #include "TupleOfInstances.h"
+#include "TypeManip.h"
 #include "Utility.h"
 
 #define CPYCPPYY_INTERNAL 1
@@ -27,6 +30,7 @@ PyObject* Instance_FromVoidPtr(
 
 // Standard
 #include <algorithm>
+#include <chrono>
 #include <map>
 #include <set>
 #include <string>
@@ -258,7 +262,7 @@ namespace CPyCppyy {
     PyObject* gSegvException = nullptr;
     PyObject* gIllException  = nullptr;
     PyObject* gAbrtException = nullptr;
-    std::set<Cppyy::TCppType_t> gPinnedTypes;
+    bool gLazyMethods = true;     // create class methods on first use
     std::ostringstream gCapturedError;
     std::streambuf* gOldErrorBuffer = nullptr;
 
@@ -457,6 +461,19 @@ static PyObject* SetCppLazyLookup(PyObject*, PyObject* args)
 }
 
 //----------------------------------------------------------------------------
+static PyObject* gTemplateClasses = nullptr;   // (name, targs...) -> scope
+
+static bool IsCacheableTemplateKey(PyObject* args)
+{
+// only names, types, and (exact) integers, as e.g. 1 == True == 1.0 as dict keys
+    for (Py_ssize_t i = 0; i < PyTuple_GET_SIZE(args); ++i) {
+        PyObject* item = PyTuple_GET_ITEM(args, i);
+        if (!CPyCppyy_PyText_Check(item) && !PyType_Check(item) && !PyInt_CheckExact(item))
+            return false;
+    }
+    return true;
+}
+
 static PyObject* MakeCppTemplateClass(PyObject*, PyObject* args)
 {
 // Create a binding for a templated class instantiation.
@@ -468,13 +485,188 @@ static PyObject* MakeCppTemplateClass(PyObject*, PyObject* args)
         return nullptr;
     }
 
+// repeated instantiations go straight to the scope resolved the first time
+    bool cacheable = IsCacheableTemplateKey(args);
+    if (cacheable && gTemplateClasses) {
+        PyObject* pyscope = PyDict_GetItem(gTemplateClasses, args);
+        if (pyscope)
+            return CreateScopeProxy((Cppyy::TCppScope_t)PyLong_AsVoidPtr(pyscope));
+    }
+
 // build "< type, type, ... >" part of class name (modifies pyname)
     const std::string& tmpl_name =
         Utility::ConstructTemplateArgs(PyTuple_GET_ITEM(args, 0), args, nullptr, Utility::kNone, 1);
     if (!tmpl_name.size())
         return nullptr;
 
-    return CreateScopeProxy(tmpl_name);
+    PyObject* pyclass = CreateScopeProxy(tmpl_name);
+    if (cacheable && pyclass && CPPScope_Check(pyclass)) {
+        if (!gTemplateClasses) gTemplateClasses = PyDict_New();
+        PyObject* pyscope = PyLong_FromVoidPtr((void*)((CPPScope*)pyclass)->fCppType);
+        if (PyDict_SetItem(gTemplateClasses, args, pyscope) != 0)
+            PyErr_Clear();
+        Py_DECREF(pyscope);
+    }
+
+    return pyclass;
+}
+
+//----------------------------------------------------------------------------
+struct TemplateSpec_t {
+    std::string fName;                 // display name for timing report
+    PyObject*   fScope = nullptr;      // function templates only
+    std::string fFunc;
+    std::string fProto;
+};
+
+static bool ParseTemplateSpec(PyObject* item, TemplateSpec_t& spec)
+{
+// Class templates are given by their full name, function templates as a tuple of
+// (scope, name[, argument types]), with the scope a bound class/namespace or name.
+    if (CPyCppyy_PyText_Check(item)) {
+        spec.fName = CPyCppyy_PyText_AsString(item);
+        return true;
+    }
+
+    PyObject* pyscope = nullptr; const char* func = nullptr; const char* proto = "";
+    if (!PyTuple_Check(item) || !PyArg_ParseTuple(item, const_cast<char*>("Os|s"), &pyscope, &func, &proto)) {
+        PyErr_Clear();
+        PyErr_SetString(PyExc_TypeError,
+            "expected class template name or (scope, function name[, argument types]) tuple");
+        return false;
+    }
+
+    if (CPyCppyy_PyText_Check(pyscope))
+        spec.fScope = CreateScopeProxy(CPyCppyy_PyText_AsString(pyscope));
+    else if (CPPScope_Check(pyscope)) {
+        Py_INCREF(pyscope);
+        spec.fScope = pyscope;
+    } else
+        PyErr_SetString(PyExc_TypeError, "function template scope should be a C++ class or namespace");
+    if (!spec.fScope)
+        return false;
+
+    spec.fFunc  = func;
+    spec.fProto = proto;
+    spec.fName  = Cppyy::GetScopedFinalName(((CPPScope*)spec.fScope)->fCppType);
+    spec.fName += (spec.fName.empty() ? "" : "::") + spec.fFunc + "(" + spec.fProto + ")";
+    return true;
+}
+
+static bool RegisterTemplateSpec(const TemplateSpec_t& spec)
+{
+// Create the proxy for a (now presumably instantiated) specialization, which will
+// instantiate it on the spot if not.
+    if (!spec.fScope) {
+        PyObject* pyclass = CreateScopeProxy(spec.fName);
+        Py_XDECREF(pyclass);
+        return (bool)pyclass;
+    }
+
+    std::string::size_type pos = spec.fFunc.find('<');
+    PyObject* pytmpl = PyObject_GetAttrString(spec.fScope,
+        pos == std::string::npos ? spec.fFunc.c_str() : spec.fFunc.substr(0, pos).c_str());
+    if (!pytmpl)
+        return false;
+
+    bool ok = false;
+    if (TemplateProxy_Check(pytmpl)) {
+        Cppyy::TCppMethod_t cppmeth = Cppyy::GetMethodTemplate(
+            ((CPPScope*)spec.fScope)->fCppType, spec.fFunc, spec.fProto);
+        if (cppmeth) {
+            PyObject* pyol = ((TemplateProxy*)pytmpl)->AddInstantiation(
+                spec.fFunc, cppmeth, Cppyy::GetMethodFullName(cppmeth));
+            ok = (bool)pyol;
+            Py_XDECREF(pyol);
+        }
+    }
+    Py_DECREF(pytmpl);
+
+    if (!ok && !PyErr_Occurred())
+        PyErr_Format(PyExc_TypeError, "failed to instantiate %s", spec.fName.c_str());
+    return ok;
+}
+
+static PyObject* InstantiateTemplates(PyObject*, PyObject* args)
+{
+// Instantiate a list of class and function template specializations. All are
+// declared in a single unit of code, which is compiled once, after which their
+// proxies are created. If compilation fails (e.g. b/c one of the specializations
+// is not valid), each will be instantiated individually instead. Returns the
+// compilation time and a list of (name, seconds, success) for each proxy.
+    PyObject* pyspecs = nullptr;
+    if (!PyArg_ParseTuple(args, const_cast<char*>("O"), &pyspecs))
+        return nullptr;
+
+    PyObject* seq = PySequence_Fast(pyspecs, "expected a sequence of template specializations");
+    if (!seq)
+        return nullptr;
+
+    std::vector<TemplateSpec_t> specs(PySequence_Fast_GET_SIZE(seq));
+    for (Py_ssize_t i = 0; i < (Py_ssize_t)specs.size(); ++i) {
+        if (!ParseTemplateSpec(PySequence_Fast_GET_ITEM(seq, i), specs[i])) {
+            Py_DECREF(seq);
+            for (auto& spec : specs) Py_XDECREF(spec.fScope);
+            return nullptr;
+        }
+    }
+    Py_DECREF(seq);
+
+// class templates are instantiated by requiring them to be complete, function
+// templates by use from a wrapper that is never called (arguments are passed as
+// pointers to not require copyability)
+    static int sBatchCount = 0;
+    std::ostringstream code;
+    std::string wrapper = "__cppyy_batch" + std::to_string(++sBatchCount);
+    code << "#include <type_traits>\n#include <utility>\n"
+            "namespace __cppyy_internal {\nvoid " << wrapper << "() {\n";
+    for (const auto& spec : specs) {
+        if (!spec.fScope)
+            code << "  (void)sizeof(" << spec.fName << ");\n";
+    }
+    code << "}\n";
+
+    int iwrap = 0;
+    for (const auto& spec : specs) {
+        if (!spec.fScope)
+            continue;
+
+        Cppyy::TCppScope_t scope = ((CPPScope*)spec.fScope)->fCppType;
+        const std::string& scname = Cppyy::GetScopedFinalName(scope);
+        bool isNS = Cppyy::IsNamespace(scope);
+        if (!isNS && TypeManip::template_base(Cppyy::GetFinalName(scope)) == \
+                spec.fFunc.substr(0, spec.fFunc.find('<')))
+            continue;                // constructors are left to the proxy
+
+        const std::vector<std::string>& argtypes = \
+            TypeManip::extract_arg_types("(" + spec.fProto + ")");
+        code << "void " << wrapper << "_" << iwrap++ << "(";
+        if (!isNS)
+            code << "::" << scname << "* self" << (argtypes.empty() ? "" : ", ");
+        for (size_t iarg = 0; iarg < argtypes.size(); ++iarg)
+            code << (iarg ? ", " : "") << "std::add_pointer<" << argtypes[iarg] << ">::type a" << iarg;
+        code << ") {\n  " << (isNS ? "::" + scname + (scname.empty() ? "" : "::") : "self->") << spec.fFunc << "(";
+        for (size_t iarg = 0; iarg < argtypes.size(); ++iarg)
+            code << (iarg ? ", " : "") << "std::forward<" << argtypes[iarg] << ">(*a" << iarg << ")";
+        code << ");\n}\n";
+    }
+    code << "}";
+
+    auto start = std::chrono::steady_clock::now();
+    Utility::Compile(code.str(), true /* silent */);
+    double tcompile = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    PyObject* timings = PyList_New(specs.size());
+    for (Py_ssize_t i = 0; i < (Py_ssize_t)specs.size(); ++i) {
+        start = std::chrono::steady_clock::now();
+        bool ok = RegisterTemplateSpec(specs[i]);
+        double t = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        if (!ok) PyErr_Clear();
+        PyList_SET_ITEM(timings, i, Py_BuildValue("(sdO)", specs[i].fName.c_str(), t, ok ? Py_True : Py_False));
+        Py_XDECREF(specs[i].fScope);
+    }
+
+    return Py_BuildValue("(dN)", tcompile, timings);
 }
 
 //----------------------------------------------------------------------------
@@ -637,7 +829,8 @@ static PyObject* AsCTypes(PyObject* /* unused */, PyObject* args, PyObject* kwds
 //----------------------------------------------------------------------------
 static PyObject* AsMemoryView(PyObject* /* unused */, PyObject* pyobject)
 {
-// Return a raw memory view on arrays of PODs.
+// Return a raw memory view on arrays of PODs; if the class layout can be fully
+// described, the view has a record format, otherwise it's untyped bytes.
     if (!CPPInstance_Check(pyobject)) {
         PyErr_SetString(PyExc_TypeError, "C++ object proxy expected");
         return nullptr;
@@ -661,7 +854,7 @@ static PyObject* AsMemoryView(PyObject* /* unused */, PyObject* pyobject)
     view.itemsize       = Cppyy::SizeOf(klass);
     view.len            = view.itemsize * array_len;
     view.readonly       = 0;
-    view.format         = NULL;   // i.e. "B" assumed
+    view.format         = (char*)((CPPClass*)Py_TYPE(pyobject))->GetRecordFormat(); // null: "B"
     view.ndim           = 1;
     view.shape          = NULL;
     view.strides        = NULL;
@@ -671,6 +864,252 @@ static PyObject* AsMemoryView(PyObject* /* unused */, PyObject* pyobject)
     return PyMemoryView_FromBuffer(&view);
 }
 
+//----------------------------------------------------------------------------
+static PyObject* FieldView(PyObject* /* unused */, PyObject* args)
+{
+// Return a strided view on a single data member of all elements in an array of
+// objects (C-style array, std::vector, std::array, etc.) without copying.
+    PyObject* container = nullptr; PyObject* pyname = nullptr;
+    if (!PyArg_ParseTuple(args, const_cast<char*>("OO!:field_view"),
+            &container, &CPyCppyy_PyText_Type, &pyname))
+        return nullptr;
+
+// locate the first element and the number of elements
+    CPPInstance* first = nullptr;
+    Py_ssize_t nelems = -1;
+    if (TupleOfInstances_CheckExact(container)) {
+        nelems = PyTuple_GET_SIZE(container);
+        if (nelems && CPPInstance_Check(PyTuple_GET_ITEM(container, 0))) {
+            first = (CPPInstance*)PyTuple_GET_ITEM(container, 0);
+            Py_INCREF(first);
+        }
+    } else if (CPPInstance_Check(container) && ((CPPInstance*)container)->ArrayLength() >= 0) {
+        first = (CPPInstance*)container;
+        Py_INCREF(first);
+        nelems = first->ArrayLength();
+    } else if (CPPInstance_Check(container)) {
+    // STL-like container with contiguous storage
+        PyObject* pydata = PyObject_CallMethod(container, (char*)"data", nullptr);
+        if (!pydata)
+            return nullptr;
+
+        if (CPPInstance_Check(pydata)) {
+            first = (CPPInstance*)pydata;
+            nelems = first->ArrayLength();
+            if (nelems < 0) nelems = PySequence_Size(container);
+        } else
+            Py_DECREF(pydata);
+    }
+
+    if (nelems == 0) {
+        Py_XDECREF(first);
+        PyErr_SetString(PyExc_ValueError, "can not create a field view on an empty container");
+        return nullptr;
+    }
+
+    if (!first || nelems < 0) {
+        Py_XDECREF(first);
+        if (!PyErr_Occurred())
+            PyErr_SetString(PyExc_TypeError, "array of C++ objects of known size expected");
+        return nullptr;
+    }
+
+    Cppyy::TCppType_t klass = first->ObjectIsA(false);
+    Py_ssize_t stride = (Py_ssize_t)Cppyy::SizeOf(klass);
+
+// locate the data member, including those from base classes
+    CPPDataMember* pyprop = (CPPDataMember*)_PyType_Lookup(Py_TYPE(first), pyname);
+    if (!CPPDataMember_Check(pyprop)) {
+        if (pyprop)
+            PyErr_Format(PyExc_TypeError,
+                "%s is not a valid data member", CPyCppyy_PyText_AsString(pyname));
+        else
+            PyErr_Format(PyExc_AttributeError, "%s has no data member %s",
+                Cppyy::GetScopedFinalName(klass).c_str(), CPyCppyy_PyText_AsString(pyname));
+        Py_DECREF(first);
+        return nullptr;
+    }
+
+    char* start = (char*)first->GetObject();
+    char* field = (char*)pyprop->GetAddress(first);
+    Py_DECREF(first);
+
+// static data does not live in the objects; arrays and pointers are not flat
+    const std::string& ftype = pyprop->fFullType;
+    if (!field || field < start || start + stride <= field ||
+            ftype.find_first_of("[*&") != std::string::npos) {
+        if (!PyErr_Occurred())
+            PyErr_Format(PyExc_TypeError,
+                "%s is not a flat instance data member", CPyCppyy_PyText_AsString(pyname));
+        return nullptr;
+    }
+
+// let the array converter pick the view type, then spread it over the elements
+    Converter* cnv = CreateConverter(ftype+"[]", {nelems});
+    PyObject* result = cnv ? cnv->FromMemory(&field) : nullptr;
+    if (cnv && cnv->HasState()) delete cnv;
+
+    if (!LowLevelView_CheckExact(result) ||
+            !((LowLevelView*)result)->restride(stride)) {
+        Py_XDECREF(result);
+        if (!PyErr_Occurred())
+            PyErr_Format(PyExc_TypeError,
+                "field views are only supported for builtin types, not %s", ftype.c_str());
+        return nullptr;
+    }
+
+// keep the container alive for as long as the view is
+    Py_INCREF(container);
+    ((LowLevelView*)result)->fBufInfo.obj = container;
+
+    return result;
+}
+
+//----------------------------------------------------------------------------
+static char* MV_kwlist[] = {(char*)"path", (char*)"dtype", (char*)"shape",
+    (char*)"mode", (char*)"advice", NULL};
+
+static PyObject* MmapView(PyObject* /* unused */, PyObject* args, PyObject* kwds)
+{
+// Map a file into memory and return a typed low level view on it. The mapping is
+// done through Python's mmap module; the view holds the only reference to the
+// mmap object, so that the file is unmapped when the view (and all views derived
+// from it) are gone. Modes are "r" (read-only), "r+" (write-through), and "c"
+// (copy-on-write); the advice, if any, is passed to madvise() where available.
+    const char* path = nullptr; const char* dtype = nullptr;
+    PyObject* pyshape = nullptr; const char* mode = "r"; const char* advice = nullptr;
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, const_cast<char*>("ss|Ozz:mmap_view"),
+            MV_kwlist, &path, &dtype, &pyshape, &mode, &advice))
+        return nullptr;
+
+    const char* access = nullptr; const char* fmode = "rb";
+    if (!mode || strcmp(mode, "r") == 0)
+        access = "ACCESS_READ";
+    else if (strcmp(mode, "r+") == 0) {
+        access = "ACCESS_WRITE";
+        fmode = "r+b";
+    } else if (strcmp(mode, "c") == 0)
+        access = "ACCESS_COPY";
+    else {
+        PyErr_Format(PyExc_ValueError, "unknown mode \"%s\" (expected \"r\", \"r+\", or \"c\")", mode);
+        return nullptr;
+    }
+
+    Py_ssize_t itemsize = (Py_ssize_t)Cppyy::SizeOf(dtype);
+    if (itemsize <= 0) {
+        PyErr_Format(PyExc_TypeError, "unknown element type \"%s\"", dtype);
+        return nullptr;
+    }
+
+// requested shape, if any, determines the size of the mapping
+    std::vector<dim_t> shape;
+    Py_ssize_t nbytes = 0;
+    if (pyshape && pyshape != Py_None) {
+        PyObject* pyshtup = PyTuple_Check(pyshape) ? pyshape : PyTuple_Pack(1, pyshape);
+        if (!pyshtup) return nullptr;
+        nbytes = itemsize;
+        for (Py_ssize_t idim = 0; idim < PyTuple_GET_SIZE(pyshtup); ++idim) {
+            dim_t sz = (dim_t)PyInt_AsSsize_t(PyTuple_GET_ITEM(pyshtup, idim));
+            if (sz == (dim_t)-1 && PyErr_Occurred()) break;
+            if (sz <= 0) {
+                PyErr_SetString(PyExc_ValueError, "dimensions must be positive");
+                break;
+            }
+            shape.push_back(sz);
+            nbytes *= sz;
+        }
+        if (pyshtup != pyshape) Py_DECREF(pyshtup);
+        if (PyErr_Occurred() || shape.empty()) {
+            if (!PyErr_Occurred())
+                PyErr_SetString(PyExc_ValueError, "empty shape");
+            return nullptr;
+        }
+    }
+
+// map the file; the mmap object holds its own duplicate of the file descriptor
+    static PyObject* mmmod = PyImport_ImportModule("mmap");     // ref-count kept
+    static PyObject* iomod = PyImport_ImportModule("io");       // ref-count kept
+    if (!mmmod || !iomod)
+        return nullptr;
+
+    PyObject* pyfile = PyObject_CallMethod(iomod, (char*)"open", (char*)"ss", path, fmode);
+    if (!pyfile)
+        return nullptr;
+
+    PyObject* mmap = nullptr;
+    PyObject* pyfileno = PyObject_CallMethod(pyfile, (char*)"fileno", nullptr);
+    PyObject* pyaccess = PyObject_GetAttrString(mmmod, access);
+    if (pyfileno && pyaccess) {
+        PyObject* mmargs = Py_BuildValue((char*)"(On)", pyfileno, nbytes);
+        PyObject* mmkwds = Py_BuildValue((char*)"{sO}", "access", pyaccess);
+        PyObject* mmtype = PyObject_GetAttrString(mmmod, "mmap");
+        if (mmargs && mmkwds && mmtype)
+            mmap = PyObject_Call(mmtype, mmargs, mmkwds);
+        Py_XDECREF(mmtype);
+        Py_XDECREF(mmkwds);
+        Py_XDECREF(mmargs);
+    }
+    Py_XDECREF(pyaccess);
+    Py_XDECREF(pyfileno);
+
+    PyObject* pyclose = PyObject_CallMethod(pyfile, (char*)"close", nullptr);
+    Py_XDECREF(pyclose);
+    Py_DECREF(pyfile);
+    if (!mmap || !pyclose) {
+        Py_XDECREF(mmap);
+        return nullptr;
+    }
+
+    if (advice) {
+        std::string madv = "MADV_";
+        for (const char* c = advice; *c; ++c) madv.push_back((char)toupper(*c));
+        PyObject* pyadv = PyObject_GetAttrString(mmmod, madv.c_str());
+        PyObject* res = pyadv ? PyObject_CallMethod(mmap, (char*)"madvise", (char*)"O", pyadv) : nullptr;
+        Py_XDECREF(pyadv);
+        if (!res) {
+            if (PyErr_ExceptionMatches(PyExc_AttributeError)) {
+                PyErr_Clear();
+                PyErr_Format(PyExc_ValueError, "madvise() with \"%s\" not available", advice);
+            }
+            Py_DECREF(mmap);
+            return nullptr;
+        }
+        Py_DECREF(res);
+    }
+
+// the address of the mapping is stable for the lifetime of the mmap object
+    Py_buffer bufinfo;
+    memset(&bufinfo, 0, sizeof(Py_buffer));
+    if (PyObject_GetBuffer(mmap, &bufinfo, PyBUF_SIMPLE) < 0) {
+        Py_DECREF(mmap);
+        return nullptr;
+    }
+    void* buf = bufinfo.buf;
+    Py_ssize_t buflen = bufinfo.len;
+    PyBuffer_Release(&bufinfo);
+
+    if (shape.empty())
+        shape.push_back(buflen / itemsize);
+
+    Converter* cnv = CreateConverter(std::string{dtype}+"[]", dims_t((dim_t)shape.size(), shape.data()));
+    PyObject* result = cnv ? cnv->FromMemory(&buf) : nullptr;
+    if (cnv && cnv->HasState()) delete cnv;
+
+    if (!LowLevelView_CheckExact(result)) {
+        Py_XDECREF(result);
+        Py_DECREF(mmap);
+        if (!PyErr_Occurred())
+            PyErr_Format(PyExc_TypeError, "mapped views are only supported for builtin types, not %s", dtype);
+        return nullptr;
+    }
+
+    LowLevelView* llview = (LowLevelView*)result;
+    llview->fBufInfo.readonly = strcmp(access, "ACCESS_READ") == 0;
+    llview->fBufInfo.obj = mmap;         // steals reference
+
+    return result;
+}
+
 //----------------------------------------------------------------------------
 static PyObject* BindObject(PyObject*, PyObject* args, PyObject* kwds)
 {
@@ -888,7 +1327,7 @@ static PyObject* PinType(PyObject*, PyObject* pyclass)
         return nullptr;
     }
 
-    gPinnedTypes.insert(((CPPClass*)pyclass)->fCppType);
+    PinScope(((CPPClass*)pyclass)->fCppType);
 
     Py_RETURN_NONE;
 }
@@ -942,6 +1381,81 @@ static PyObject* SetGlobalSignalPolicy(PyObject*, PyObject* args)
     Py_RETURN_FALSE;
 }
 
+//----------------------------------------------------------------------------
+static PyObject* SetLazyMethods(PyObject*, PyObject* args)
+{
+// Set whether methods of classes created from now on are created on first use,
+// rather than all at once when building the class; returns the old setting.
+    PyObject* lazy = nullptr;
+    if (!PyArg_ParseTuple(args, const_cast<char*>("O"), &lazy))
+        return nullptr;
+
+    PyObject* old = gLazyMethods ? Py_True : Py_False;
+    gLazyMethods = PyObject_IsTrue(lazy);
+    Py_INCREF(old);
+    return old;
+}
+
+//----------------------------------------------------------------------------
+static PyObject* SetReflectionCache(PyObject*, PyObject* args)
+{
+// Use the given file to cache class reflection information across processes;
+// the key is a fingerprint of the loaded headers and libraries, which is needed
+// to reject stale caches. Returns True if an existing cache was loaded.
+    const char* path = nullptr; const char* key = nullptr;
+    if (!PyArg_ParseTuple(args, const_cast<char*>("ss"), &path, &key))
+        return nullptr;
+
+    if (ReflectionCache::Open(path, key)) {
+        Py_RETURN_TRUE;
+    }
+
+    Py_RETURN_FALSE;
+}
+
+//----------------------------------------------------------------------------
+static PyObject* PrepareDispatchers(PyObject*, PyObject* args)
+{
+// Compile the cross-inheritance dispatchers for a list of (bases, method names) in
+// one go, ahead of deriving the Python classes that will use them.
+    PyObject* specs = nullptr;
+    if (!PyArg_ParseTuple(args, const_cast<char*>("O"), &specs))
+        return nullptr;
+
+    return CPyCppyy::PrepareDispatchers(specs);
+}
+
+//----------------------------------------------------------------------------
+static PyObject* SetLookupCache(PyObject*, PyObject* args)
+{
+// Set whether failed attribute lookups on scopes are remembered; returns the old
+// setting. If enabled, _invalidate_lookup_cache() must be called after loading
+// code or libraries from outside the bindings (e.g. cppdef, load_library).
+    PyObject* enable = nullptr;
+    if (!PyArg_ParseTuple(args, const_cast<char*>("O"), &enable))
+        return nullptr;
+
+    PyObject* old = CPyCppyy::SetLookupCache(PyObject_IsTrue(enable)) ? Py_True : Py_False;
+    Py_INCREF(old);
+    return old;
+}
+
+//----------------------------------------------------------------------------
+static PyObject* InvalidateLookupCache(PyObject*, PyObject*)
+{
+// Forget the names that were found missing from scopes; to be called after
+// loading code or libraries from outside the bindings.
+    CPyCppyy::InvalidateLookupCache();
+    Py_RETURN_NONE;
+}
+
+//----------------------------------------------------------------------------
+static PyObject* LookupCacheStats(PyObject*, PyObject*)
+{
+// Return hits, misses, and invalidations of the negative lookup cache.
+    return GetLookupCacheStats();
+}
+
 //----------------------------------------------------------------------------
 static PyObject* SetOwnership(PyObject*, PyObject* args)
 {
@@ -1001,6 +1515,8 @@ static PyMethodDef gCPyCppyyMethods[] = {
       METH_VARARGS, (char*)"cppyy internal function"},
     {(char*) "MakeCppTemplateClass", (PyCFunction)MakeCppTemplateClass,
       METH_VARARGS, (char*)"cppyy internal function"},
+    {(char*) "_instantiate_templates", (PyCFunction)InstantiateTemplates,
+      METH_VARARGS, (char*)"cppyy internal function"},
     {(char*) "_set_cpp_lazy_lookup", (PyCFunction)SetCppLazyLookup,
       METH_VARARGS, (char*)"cppyy internal function"},
     {(char*) "_DestroyPyStrings", (PyCFunction)CPyCppyy::DestroyPyStrings,
@@ -1015,6 +1531,10 @@ static PyMethodDef gCPyCppyyMethods[] = {
       METH_VARARGS | METH_KEYWORDS, (char*)"Retrieve address of proxied object or field in a ctypes c_void_p."},
     {(char*) "as_memoryview", (PyCFunction)AsMemoryView,
       METH_O, (char*)"Represent an array of objects as raw memory."},
+    {(char*) "field_view", (PyCFunction)FieldView,
+      METH_VARARGS, (char*)"Strided view on a data member of all objects in an array."},
+    {(char*) "mmap_view", (PyCFunction)MmapView,
+      METH_VARARGS | METH_KEYWORDS, (char*)"Typed view on a memory-mapped file."},
     {(char*)"bind_object", (PyCFunction)BindObject,
       METH_VARARGS | METH_KEYWORDS, (char*) "Create an object of given type, from given address."},
     {(char*) "move", (PyCFunction)Move,
@@ -1031,6 +1551,18 @@ static PyMethodDef gCPyCppyyMethods[] = {
       METH_VARARGS, (char*)"Determines object ownership model."},
     {(char*) "SetGlobalSignalPolicy", (PyCFunction)SetGlobalSignalPolicy,
       METH_VARARGS, (char*)"Trap signals in safe mode to prevent interpreter abort."},
+    {(char*) "_set_lazy_methods", (PyCFunction)SetLazyMethods,
+      METH_VARARGS, (char*)"cppyy internal function"},
+    {(char*) "_set_reflection_cache", (PyCFunction)SetReflectionCache,
+      METH_VARARGS, (char*)"cppyy internal function"},
+    {(char*) "_prepare_dispatchers", (PyCFunction)PrepareDispatchers,
+      METH_VARARGS, (char*)"cppyy internal function"},
+    {(char*) "_set_lookup_cache", (PyCFunction)SetLookupCache,
+      METH_VARARGS, (char*)"cppyy internal function"},
+    {(char*) "_invalidate_lookup_cache", (PyCFunction)InvalidateLookupCache,
+      METH_NOARGS, (char*)"cppyy internal function"},
+    {(char*) "_lookup_cache_stats", (PyCFunction)LookupCacheStats,
+      METH_NOARGS, (char*)"cppyy internal function"},
     {(char*) "SetOwnership", (PyCFunction)SetOwnership,
       METH_VARARGS, (char*)"Modify held C++ object ownership."},
     {(char*) "AddSmartPtrType", (PyCFunction)AddSmartPtrType,
@@ -1181,6 +1713,9 @@ extern "C" void initlibcppyy()
     if (PyType_Ready(&IndexIter_Type) < 0)
         CPYCPPYY_INIT_ERROR;
 
+    if (PyType_Ready(&STLIter_Type) < 0)
+        CPYCPPYY_INIT_ERROR;
+
     if (PyType_Ready(&VectorIter_Type) < 0)
         CPYCPPYY_INIT_ERROR;
 
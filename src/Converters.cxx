@@ -450,6 +450,19 @@ static inline bool CArraySetArg(
 
 
 //- helper for implicit conversions ------------------------------------------
+static bool IsSTLMap(Cppyy::TCppType_t klass)
+{
+    static std::map<Cppyy::TCppType_t, bool> sIsMap;
+    auto imap = sIsMap.find(klass);
+    if (imap != sIsMap.end())
+        return imap->second;
+
+    const std::string& name = Cppyy::GetScopedFinalName(klass);
+    bool ismap = name.rfind("std::map<", 0) == 0 || name.rfind("std::unordered_map<", 0) == 0;
+    sIsMap[klass] = ismap;
+    return ismap;
+}
+
 static inline CPyCppyy::CPPInstance* ConvertImplicit(Cppyy::TCppType_t klass,
     PyObject* pyobject, CPyCppyy::Parameter& para, CPyCppyy::CallContext* ctxt, bool manage=true)
 {
@@ -461,10 +474,12 @@ static inline CPyCppyy::CPPInstance* ConvertImplicit(Cppyy::TCppType_t klass,
 
 // only proceed if implicit conversions are allowed (in "round 2") or if the
 // argument is exactly a tuple or list, as these are the equivalent of
-// initializer lists and thus "syntax" not a conversion
+// initializer lists and thus "syntax" not a conversion; likewise for a dict
+// passed to a std::map or std::unordered_map
     if (!AllowImplicit(ctxt)) {
         PyTypeObject* pytype = (PyTypeObject*)Py_TYPE(pyobject);
-        if (!(pytype == &PyList_Type || pytype == &PyTuple_Type)) {// || !CPPInstance_Check(pyobject))) {
+        if (!(pytype == &PyList_Type || pytype == &PyTuple_Type ||
+                (pytype == &PyDict_Type && IsSTLMap(klass)))) {// || !CPPInstance_Check(pyobject))) {
             if (!NoImplicit(ctxt)) ctxt->fFlags |= CallContext::kHaveImplicit;
             return nullptr;
         }
@@ -2570,27 +2585,33 @@ bool CPyCppyy::PyObjectConverter::ToMemory(PyObject* value, void* address, PyObj
 
 
 //- function pointer converter -----------------------------------------------
+// Python callables are passed as C function pointers through JIT-ed wrappers. These
+// are compiled per return type/signature in chunks, each wrapper calling the callable
+// stored in its own slot, so that a new callable only needs to be assigned a slot.
+static const int kWrapperChunk = 32;
 static unsigned int sWrapperCounter = 0;
-// cache mapping signature/return type to python callable and corresponding wrapper
 typedef std::string RetSigKey_t;
-static std::map<RetSigKey_t, std::vector<void*>> sWrapperFree;
-static std::map<RetSigKey_t, std::map<PyObject*, void*>> sWrapperLookup;
-static std::map<PyObject*, std::pair<void*, RetSigKey_t>> sWrapperWeakRefs;
-static std::map<void*, PyObject**> sWrapperReference;
+struct WrapperPool_t {
+    std::vector<void*>          fWrappers;    // wrapper function, by slot index
+    std::vector<PyObject**>     fSlots;       // callable (borrowed) used by the wrapper
+    std::vector<size_t>         fFree;        // unused slot indices
+    std::map<PyObject*, size_t> fLookup;      // callable -> slot index
+};
+static std::map<RetSigKey_t, WrapperPool_t> sWrapperPools;
+static std::map<PyObject*, std::pair<size_t, RetSigKey_t>> sWrapperWeakRefs;
 
 static PyObject* WrapperCacheEraser(PyObject*, PyObject* pyref)
 {
     auto ipos = sWrapperWeakRefs.find(pyref);
     if (ipos != sWrapperWeakRefs.end()) {
-        auto key = ipos->second.second;
+        WrapperPool_t& pool = sWrapperPools[ipos->second.second];
 
     // disable this callback and store on free list for possible re-use
-        void* wpraddress = ipos->second.first;
-        PyObject** oldref = sWrapperReference[wpraddress];
-        const auto& lookup = sWrapperLookup.find(key);
-        if (lookup != sWrapperLookup.end()) lookup->second.erase(*oldref);
+        size_t islot = ipos->second.first;
+        PyObject** oldref = pool.fSlots[islot];
+        pool.fLookup.erase(*oldref);
         *oldref = nullptr;        // to detect deletions
-        sWrapperFree[ipos->second.second].push_back(wpraddress);
+        pool.fFree.push_back(islot);
 
     // clean up and remove weak reference from admin
         Py_DECREF(ipos->first);
@@ -2605,6 +2626,90 @@ static PyMethodDef gWrapperCacheEraserMethodDef = {
     METH_O, nullptr
 };
 
+static bool AddWrapperChunk(WrapperPool_t& pool, const std::string& rettype, const std::string& signature)
+{
+// Compile a chunk of wrappers, with new slots, for the given return type/signature.
+    using namespace CPyCppyy;
+
+    if (!Utility::IncludePython())
+        return false;
+
+// extract argument types
+    const std::vector<std::string>& argtypes = TypeManip::extract_arg_types(signature);
+    int nArgs = (int)argtypes.size();
+
+// wrapper name
+    std::ostringstream wname;
+    wname << "fptr_wrap" << ++sWrapperCounter;
+
+// slots for the callables (note: never released, as neither are the wrappers)
+    PyObject** slots = new PyObject*[kWrapperChunk]{};
+
+// build wrapper function code, templated on the slot index
+    std::ostringstream code;
+    code << "namespace __cppyy_internal {\n"
+            "  template<int I>\n  "
+         << rettype << " " << wname.str() << "(";
+    for (int i = 0; i < nArgs; ++i) {
+        code << argtypes[i] << " arg" << i;
+        if (i != nArgs-1) code << ", ";
+    }
+    code << ") {\n";
+
+// start function body
+    Utility::ConstructCallbackPreamble(rettype, argtypes, code);
+
+// function call itself and cleanup
+    code << "    PyObject* pyfunc = ((PyObject**)" << (intptr_t)slots << ")[I];\n"
+            "    PyObject* pyresult = nullptr;\n"
+            "    if (pyfunc) pyresult = PyObject_CallFunctionObjArgs(pyfunc";
+    for (int i = 0; i < nArgs; ++i)
+        code << ", pyargs[" << i << "]";
+    code << ", NULL);\n"
+            "    else PyErr_SetString(PyExc_TypeError, \"callable was deleted\");\n";
+
+// close
+    Utility::ConstructCallbackReturn(rettype, nArgs, code);
+
+// helper to collect the addresses of all wrappers in the chunk
+    code << "  void " << wname.str() << "_addresses(void** wrappers) {\n";
+    for (int i = 0; i < kWrapperChunk; ++i)
+        code << "    wrappers[" << i << "] = (void*)&" << wname.str() << "<" << i << ">;\n";
+    code << "  }\n";
+
+// end of namespace
+    code << "}";
+
+// finally, compile the code
+    if (!Utility::Compile(code.str())) {
+        delete [] slots;
+        return false;
+    }
+
+    static Cppyy::TCppScope_t scope = Cppyy::GetScope("__cppyy_internal");
+    const auto& idx = Cppyy::GetMethodIndicesFromName(scope, wname.str()+"_addresses");
+    if (idx.empty())
+        return false;
+    typedef void (*addresses_t)(void**);
+    addresses_t addresses = (addresses_t)Cppyy::GetFunctionAddress(Cppyy::GetMethod(scope, idx[0]), false);
+    if (!addresses)
+        return false;
+
+    void* wrappers[kWrapperChunk];
+    addresses(wrappers);
+
+// add the new slots, with the lowest index to be handed out first
+    size_t first = pool.fWrappers.size();
+    for (int i = 0; i < kWrapperChunk; ++i) {
+        pool.fWrappers.push_back(wrappers[i]);
+        pool.fSlots.push_back(&slots[i]);
+    }
+    for (int i = kWrapperChunk-1; 0 <= i; --i)
+        pool.fFree.push_back(first+i);
+
+    return true;
+}
+
 static void* PyFunction_AsCPointer(PyObject* pyobject,
     const std::string& rettype, const std::string& signature)
 {
@@ -2654,95 +2759,28 @@ static void* PyFunction_AsCPointer(PyObject* pyobject,
     }
 
     if (PyCallable_Check(pyobject)) {
-    // generic python callable: create a C++ wrapper function
-        void* wpraddress = nullptr;
+    // generic python callable: use a C++ wrapper function from the pool
+        WrapperPool_t& pool = sWrapperPools[rettype+signature];
 
     // re-use existing wrapper if possible
-        auto key = rettype+signature;
-        const auto& lookup = sWrapperLookup.find(key);
-        if (lookup != sWrapperLookup.end()) {
-            const auto& existing = lookup->second.find(pyobject);
-            if (existing != lookup->second.end() && *sWrapperReference[existing->second] == pyobject)
-                wpraddress = existing->second;
-        }
+        const auto& existing = pool.fLookup.find(pyobject);
+        if (existing != pool.fLookup.end() && *pool.fSlots[existing->second] == pyobject)
+            return pool.fWrappers[existing->second];
 
-     // check for a pre-existing, unused, wrapper if not found
-        if (!wpraddress) {
-           const auto& freewrap = sWrapperFree.find(key);
-           if (freewrap != sWrapperFree.end() && !freewrap->second.empty()) {
-               wpraddress = freewrap->second.back();
-               freewrap->second.pop_back();
-               *(sWrapperReference[wpraddress]) = pyobject;
-               sWrapperLookup[key][pyobject] = wpraddress;
-               PyObject* wref = PyWeakref_NewRef(pyobject, sWrapperCacheEraser);
-               if (wref) sWrapperWeakRefs[wref] = std::make_pair(wpraddress, key);
-               else PyErr_Clear();     // happens for builtins which don't need this
-           }
-        }
+    // otherwise, take an unused wrapper, compiling new ones as needed
+        if (pool.fFree.empty() && !AddWrapperChunk(pool, rettype, signature))
+            return nullptr;
 
-     // create wrapper if no re-use possible
-        if (!wpraddress) {
-            if (!Utility::IncludePython())
-                return nullptr;
-
-        // extract argument types
-            const std::vector<std::string>& argtypes = TypeManip::extract_arg_types(signature);
-            int nArgs = (int)argtypes.size();
-
-        // wrapper name
-            std::ostringstream wname;
-            wname << "fptr_wrap" << ++sWrapperCounter;
-
-       // build wrapper function code
-            std::ostringstream code;
-            code << "namespace __cppyy_internal {\n  "
-                 << rettype << " " << wname.str() << "(";
-            for (int i = 0; i < nArgs; ++i) {
-                code << argtypes[i] << " arg" << i;
-                if (i != nArgs-1) code << ", ";
-            }
-            code << ") {\n";
-
-        // start function body
-            Utility::ConstructCallbackPreamble(rettype, argtypes, code);
-
-        // create a referenceable pointer
-            PyObject** ref = new PyObject*{pyobject};
-
-        // function call itself and cleanup
-            code << "    PyObject** ref = (PyObject**)" << (intptr_t)ref << ";\n"
-                    "    PyObject* pyresult = nullptr;\n"
-                    "    if (*ref) pyresult = PyObject_CallFunctionObjArgs(*ref";
-            for (int i = 0; i < nArgs; ++i)
-                code << ", pyargs[" << i << "]";
-            code << ", NULL);\n"
-                    "    else PyErr_SetString(PyExc_TypeError, \"callable was deleted\");\n";
-
-        // close
-            Utility::ConstructCallbackReturn(rettype, nArgs, code);
-
-        // end of namespace
-            code << "}";
-
-        // finally, compile the code
-            if (!Cppyy::Compile(code.str()))
-                return nullptr;
-
-        // TODO: is there no easier way?
-            static Cppyy::TCppScope_t scope = Cppyy::GetScope("__cppyy_internal");
-            const auto& idx = Cppyy::GetMethodIndicesFromName(scope, wname.str());
-            wpraddress = Cppyy::GetFunctionAddress(Cppyy::GetMethod(scope, idx[0]), false);
-            sWrapperReference[wpraddress] = ref;
-
-        // cache the new wrapper
-            sWrapperLookup[key][pyobject] = wpraddress;
-            PyObject* wref = PyWeakref_NewRef(pyobject, sWrapperCacheEraser);
-            if (wref) sWrapperWeakRefs[wref] = std::make_pair(wpraddress, key);
-            else PyErr_Clear();     // happens for builtins which don't need this
-        }
+        size_t islot = pool.fFree.back();
+        pool.fFree.pop_back();
+        *pool.fSlots[islot] = pyobject;
+        pool.fLookup[pyobject] = islot;
+
+        PyObject* wref = PyWeakref_NewRef(pyobject, sWrapperCacheEraser);
+        if (wref) sWrapperWeakRefs[wref] = std::make_pair(islot, rettype+signature);
+        else PyErr_Clear();     // happens for builtins which don't need this
 
-    // now pass the pointer to the wrapper function (may be null)
-        return wpraddress;
+        return pool.fWrappers[islot];
     }
 
     return nullptr;
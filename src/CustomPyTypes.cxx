@@ -374,6 +374,15 @@ static PyObject* indexiter_iternext(indexiterobject* ii) {
     return result;
 }
 
+static PyObject* indexiter_length_hint(indexiterobject* ii) {
+    return PyLong_FromSsize_t(ii->ii_pos < ii->ii_len ? ii->ii_len - ii->ii_pos : 0);
+}
+
+static PyMethodDef indexiter_methods[] = {
+    {(char*)"__length_hint__", (PyCFunction)indexiter_length_hint, METH_NOARGS, nullptr},
+    {(char*)nullptr, nullptr, 0, nullptr}
+};
+
 PyTypeObject IndexIter_Type = {
     PyVarObject_HEAD_INIT(&PyType_Type, 0)
     (char*)"cppyy.indexiter",     // tp_name
@@ -388,7 +397,8 @@ PyTypeObject IndexIter_Type = {
     0, 0, 0,
     PyObject_SelfIter,            // tp_iter
     (iternextfunc)indexiter_iternext,  // tp_iternext
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+    indexiter_methods,            // tp_methods
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
 #if PY_VERSION_HEX >= 0x02030000
     , 0                           // tp_del
 #endif
@@ -459,7 +469,8 @@ PyTypeObject VectorIter_Type = {
     0, 0, 0,
     PyObject_SelfIter,            // tp_iter
     (iternextfunc)vectoriter_iternext,      // tp_iternext
-    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+    indexiter_methods,            // tp_methods
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
 #if PY_VERSION_HEX >= 0x02030000
     , 0                           // tp_del
 #endif
@@ -480,4 +491,124 @@ PyTypeObject VectorIter_Type = {
 #endif
 };
 
+
+//= CPyCppyy custom iterator for STL containers ==============================
+// Iteration state and stepping are provided by thunks, JIT-ed per container
+// type, so that no C++ calls are dispatched through Python for each element.
+static void stliter_dealloc(stliterobject* si) {
+    PyObject_GC_UnTrack(si);
+    if (si->si_state) si->si_thunks->st_free(si->si_state);
+    Py_XDECREF(si->si_container);
+    PyObject_GC_Del(si);
+}
+
+static int stliter_traverse(stliterobject* si, visitproc visit, void* arg) {
+    Py_VISIT(si->si_container);
+    return 0;
+}
+
+static PyObject* stliter_box(stliterobject* si, const stliterbox& box, void* address) {
+    address = (void*)((char*)address + box.sb_offset);
+    if (box.sb_isstring) {
+        const std::string& s = *(std::string*)address;
+        return CPyCppyy_PyText_FromStringAndSize(s.data(), (Py_ssize_t)s.size());
+    }
+
+    if (box.sb_converter)
+        return box.sb_converter->FromMemory(address);
+
+// elements live in the container, which is kept alive by the result (as for
+// vectors, identity is not maintained through the memory regulator)
+    PyObject* result = CPyCppyy::BindCppObjectNoCast(
+        (Cppyy::TCppObject_t)address, box.sb_klass, CPyCppyy::CPPInstance::kNoMemReg);
+    if (result)
+        PyObject_SetAttr(result, PyStrings::gLifeLine, si->si_container);
+    return result;
+}
+
+static PyObject* stliter_iternext(stliterobject* si) {
+    if (!si->si_state)
+        return nullptr;
+
+    void* address = si->si_thunks->st_next(si->si_state);
+    if (!address) {
+        si->si_thunks->st_free(si->si_state);
+        si->si_state = nullptr;
+        return nullptr;
+    }
+
+    switch (si->si_mode) {
+    case stliterobject::kKeys:
+        return stliter_box(si, si->si_thunks->st_key, address);
+    case stliterobject::kValues:
+        return stliter_box(si, si->si_thunks->st_value, address);
+    case stliterobject::kItems: {
+        PyObject* key = stliter_box(si, si->si_thunks->st_key, address);
+        if (!key) return nullptr;
+        PyObject* value = stliter_box(si, si->si_thunks->st_value, address);
+        if (!value) { Py_DECREF(key); return nullptr; }
+        PyObject* item = PyTuple_New(2);
+        PyTuple_SET_ITEM(item, 0, key);
+        PyTuple_SET_ITEM(item, 1, value);
+        return item;
+    }
+    default:
+        break;
+    }
+
+    return stliter_box(si, si->si_thunks->st_elem, address);
+}
+
+PyTypeObject STLIter_Type = {
+    PyVarObject_HEAD_INIT(&PyType_Type, 0)
+    (char*)"cppyy.stliterator",  // tp_name
+    sizeof(stliterobject),        // tp_basicsize
+    0,
+    (destructor)stliter_dealloc,            // tp_dealloc
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    Py_TPFLAGS_DEFAULT |
+        Py_TPFLAGS_HAVE_GC,       // tp_flags
+    0,
+    (traverseproc)stliter_traverse,    // tp_traverse
+    0, 0, 0,
+    PyObject_SelfIter,            // tp_iter
+    (iternextfunc)stliter_iternext,         // tp_iternext
+    0,                            // tp_methods
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+#if PY_VERSION_HEX >= 0x02030000
+    , 0                           // tp_del
+#endif
+#if PY_VERSION_HEX >= 0x02060000
+    , 0                           // tp_version_tag
+#endif
+#if PY_VERSION_HEX >= 0x03040000
+    , 0                           // tp_finalize
+#endif
+#if PY_VERSION_HEX >= 0x03080000
+    , 0                           // tp_vectorcall
+#endif
+#if PY_VERSION_HEX >= 0x030c0000
+    , 0                           // tp_watched
+#endif
+#if PY_VERSION_HEX >= 0x030d0000
+    , 0                           // tp_versions_used
+#endif
+};
+
+//----------------------------------------------------------------------------
+PyObject* STLIter_New(PyObject* container, void* cppcontainer, const stliterthunks* thunks, int mode)
+{
+    stliterobject* si = PyObject_GC_New(stliterobject, &STLIter_Type);
+    if (!si) return nullptr;
+
+    Py_INCREF(container);
+    si->si_container = container;
+    si->si_thunks    = thunks;
+    si->si_mode      = mode;
+    si->si_state     = thunks->st_begin(cppcontainer);
+
+    PyObject_GC_Track(si);
+    return (PyObject*)si;
+}
+
 } // namespace CPyCppyy
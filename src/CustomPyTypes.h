@@ -108,6 +108,44 @@ struct vectoriterobject : public indexiterobject {
 
 extern PyTypeObject VectorIter_Type;
 
+//- custom iterator for STL containers, driven by JIT-ed thunks ----------------
+struct stliterbox {
+    CPyCppyy::Converter*     sb_converter;                   // builtin elements
+    Cppyy::TCppType_t        sb_klass;                       // class elements
+    ptrdiff_t                sb_offset;                      // within the element
+    bool                     sb_isstring;                    // std::string, as str
+};
+
+struct stliterthunks {
+    void*                  (*st_begin)(void* container);     // returns iteration state
+    void*                  (*st_next)(void* state);          // element address or null
+    void                   (*st_free)(void* state);
+    stliterbox               st_elem;
+    stliterbox               st_key;                         // pair elements only
+    stliterbox               st_value;                       // id.
+    bool                     st_ispair;
+};
+
+struct stliterobject {
+    PyObject_HEAD
+    PyObject*                si_container;
+    void*                    si_state;
+    const stliterthunks*     si_thunks;
+    int                      si_mode;
+
+    enum EMode {
+        kElements = 0,
+        kItems    = 1,
+        kKeys     = 2,
+        kValues   = 3
+    };
+};
+
+extern PyTypeObject STLIter_Type;
+
+PyObject* STLIter_New(PyObject* container, void* cppcontainer,
+    const stliterthunks* thunks, int mode = stliterobject::kElements);
+
 } // namespace CPyCppyy
 
 #endif // !CPYCPPYY_CUSTOMPYTYPES_H
@@ -0,0 +1,60 @@
+#ifndef CPYCPPYY_DLPACK_H
+#define CPYCPPYY_DLPACK_H
+
+// Standard
+#include <stdint.h>
+
+
+namespace CPyCppyy {
+
+/** Minimal, ABI-compatible, subset of the DLPack (v0.8) tensor description, as
+    exchanged through "dltensor" capsules; see https://github.com/dmlc/dlpack
+ */
+
+namespace DLPack {
+
+enum EDeviceType {
+    kDLCPU     = 1 };
+
+enum EDataTypeCode {
+    kDLInt     = 0,
+    kDLUInt    = 1,
+    kDLFloat   = 2,
+    kDLComplex = 5,
+    kDLBool    = 6 };
+
+struct DLDevice {
+    int32_t  device_type;          // EDeviceType
+    int32_t  device_id;
+};
+
+struct DLDataType {
+    uint8_t  code;                 // EDataTypeCode
+    uint8_t  bits;
+    uint16_t lanes;
+};
+
+struct DLTensor {
+    void*      data;
+    DLDevice   device;
+    int32_t    ndim;
+    DLDataType dtype;
+    int64_t*   shape;
+    int64_t*   strides;            // in elements; null means compact row-major
+    uint64_t   byte_offset;
+};
+
+struct DLManagedTensor {
+    DLTensor dl_tensor;
+    void*    manager_ctx;
+    void   (*deleter)(DLManagedTensor* self);
+};
+
+static const char* const kCapsuleName     = "dltensor";
+static const char* const kUsedCapsuleName = "used_dltensor";
+
+} // namespace DLPack
+
+} // namespace CPyCppyy
+
+#endif // !CPYCPPYY_DLPACK_H
@@ -0,0 +1,117 @@
+// Bindings
+#include "CPyCppyy.h"
+#define CPYCPPYY_INTERNAL 1
+#include "CPyCppyy/DispatchCache.h"
+#undef CPYCPPYY_INTERNAL
+#include "CPPOverload.h"
+
+
+//-----------------------------------------------------------------------------
+bool CPyCppyy::DispatchCache::Resolve(PyObject* pyself)
+{
+// Look up the method for a new (or modified) class, with the GIL held.
+    PyGILState_STATE state = PyGILState_Ensure();
+    bool use_base = false;
+    Update(Py_TYPE(pyself), use_base);
+    PyGILState_Release(state);
+
+    return use_base;
+}
+
+//-----------------------------------------------------------------------------
+PyObject* CPyCppyy::DispatchCache::Update(PyTypeObject* pytype, bool& use_base)
+{
+// Look up the method on the given class and record the result; the GIL is held.
+    if (!fName)
+        fName = CPyCppyy_PyText_InternFromString(fCppName);
+
+// lookup through the MRO, which also assigns a version tag if the class has none
+    PyObject* func = _PyType_Lookup(pytype, fName);
+
+// what is found in the class is either the C++ method (i.e. no override) or some
+// Python callable, the latter of which is the override
+    use_base = fBaseCallable && (!func || CPPOverload_Check(func));
+
+    unsigned int tag = CurrentTag(pytype);
+    if (!tag)
+        return func;
+
+// replace the entry of the class if it has one (i.e. it was modified), otherwise
+// the oldest; readers without the GIL only ever see complete (tag, flag) states
+    int slot = -1;
+    for (int i = 0; i < kNEntries && slot < 0; ++i) {
+        if (fCalls[i].fType == pytype) slot = i;
+    }
+    if (slot < 0) {
+        slot = fNext;
+        fNext = (fNext + 1) % kNEntries;
+    }
+
+    fCalls[slot] = CallEntry{pytype, tag, func};
+    fBases[slot].store(((uint64_t)tag << 32) | (use_base ? kUseBase : 0), std::memory_order_release);
+
+    return func;
+}
+
+//-----------------------------------------------------------------------------
+PyObject* CPyCppyy::DispatchCache::Call(PyObject* pyself, PyObject* const* args, size_t nargs)
+{
+    PyTypeObject* pytype = Py_TYPE(pyself);
+    unsigned int tag = CurrentTag(pytype);
+
+    PyObject* func = nullptr;
+    bool found = false;
+    for (int i = 0; tag && i < kNEntries; ++i) {
+        if (fCalls[i].fType == pytype && fCalls[i].fTag == tag) {
+            func = fCalls[i].fFunc;
+            found = true;
+            break;
+        }
+    }
+
+    if (!found) {
+        bool use_base = false;
+        func = Update(pytype, use_base);
+    }
+
+// plain Python functions are called unbound, with self as first argument; anything
+// else (e.g. a callable object) goes through the normal attribute lookup
+    bool bound = !(func && PyFunction_Check(func));
+    PyObject* pyfunc = bound ? PyObject_GetAttr(pyself, fName) : func;
+    if (!pyfunc)
+        return nullptr;
+    if (!bound) Py_INCREF(pyfunc);
+
+    size_t nall = nargs + (bound ? 0 : 1);
+
+#if PY_VERSION_HEX >= 0x03080000
+// leave a slot at the front for use by the callee (see PY_VECTORCALL_ARGUMENTS_OFFSET)
+    PyObject* stackargs[8];
+    PyObject** callargs = nall < 8 ? stackargs : (PyObject**)PyMem_Malloc((nall+1)*sizeof(PyObject*));
+    size_t iarg = 1;
+    if (!bound) callargs[iarg++] = pyself;
+    for (size_t i = 0; i < nargs; ++i)
+        callargs[iarg++] = args[i];
+
+    PyObject* result = CPyCppyy_PyObject_Call(
+        pyfunc, callargs+1, nall | PY_VECTORCALL_ARGUMENTS_OFFSET, nullptr);
+    if (callargs != stackargs) PyMem_Free(callargs);
+#else
+    PyObject* pyargs = PyTuple_New(nall);
+    Py_ssize_t iarg = 0;
+    if (!bound) {
+        Py_INCREF(pyself);
+        PyTuple_SET_ITEM(pyargs, iarg++, pyself);
+    }
+    for (size_t i = 0; i < nargs; ++i) {
+        Py_INCREF(args[i]);
+        PyTuple_SET_ITEM(pyargs, iarg++, args[i]);
+    }
+
+    PyObject* result = PyObject_Call(pyfunc, pyargs, nullptr);
+    Py_DECREF(pyargs);
+#endif
+
+    Py_DECREF(pyfunc);
+    return result;
+}
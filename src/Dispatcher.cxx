@@ -8,14 +8,20 @@
 #include "Utility.h"
 
 // Standard
+#include <map>
 #include <set>
 #include <sstream>
+#include <string>
+#include <vector>
 
 
 //----------------------------------------------------------------------------
-static inline void InjectMethod(Cppyy::TCppMethod_t method, const std::string& mtCppName, std::ostringstream& code)
+static inline void InjectMethod(Cppyy::TCppMethod_t method, const std::string& mtCppName,
+    std::ostringstream& code, const std::string& baseName = "")
 {
-// inject implementation for an overridden method
+// inject implementation for an overridden method; if a base name is given, the method
+// is forwarded to that base (w/o acquiring the GIL) if the Python class turns out not
+// to override it after all (e.g. b/c it was removed after class creation)
     using namespace CPyCppyy;
 
 // method declaration
@@ -50,22 +56,29 @@ static inline void InjectMethod(Cppyy::TCppMethod_t method, const std::string& m
             code << " nullptr";
     }
     code << ";\n"
-            "    }\n"
-            "    Py_INCREF(iself);\n";
+            "    }\n";
+
+// the lookup of the Python override is cached on the class's version tag
+    code << "    CPYCPPYY_STATIC CPyCppyy::DispatchCache mtCache{\"" << mtCppName << "\", "
+         << (baseName.empty() ? "false" : "true") << "};\n";
+    if (!baseName.empty()) {
+        code << "    if (mtCache.UseBase(iself))\n"
+                "      return " << baseName << "::" << mtCppName << "(";
+        for (Cppyy::TCppIndex_t i = 0; i < nArgs; ++i) {
+            if (i != 0) code << ", ";
+            code << "std::forward<" << argtypes[i] << ">(arg" << i << ")";
+        }
+        code << ");\n";
+    }
+    code << "    Py_INCREF(iself);\n";
 
 // start actual function body
     Utility::ConstructCallbackPreamble(retType, argtypes, code);
 
 // perform actual method call
-#if PY_VERSION_HEX < 0x03000000
-    code << "    PyObject* mtPyName = PyString_FromString(\"" << mtCppName << "\");\n" // TODO: intern?
-#else
-    code << "    PyObject* mtPyName = PyUnicode_FromString(\"" << mtCppName << "\");\n"
-#endif
-            "    PyObject* pyresult = PyObject_CallMethodObjArgs(iself, mtPyName";
-    for (Cppyy::TCppIndex_t i = 0; i < nArgs; ++i)
-        code << ", pyargs[" << i << "]";
-    code << ", NULL);\n    Py_DECREF(mtPyName);\n    Py_DECREF(iself);\n";
+    code << "    PyObject* pyresult = mtCache.Call(iself, "
+         << (nArgs ? "pyargs.data(), " : "nullptr, ") << nArgs << ");\n"
+            "    Py_DECREF(iself);\n";
 
 // close
     Utility::ConstructCallbackReturn(retType, (int)nArgs, code);
@@ -164,20 +177,37 @@ std::vector<TCppIndex_t> FindBaseMethod(TCppScope_t tbase, const std::string mtC
 
 } // unnamed namespace
 
-bool CPyCppyy::InsertDispatcher(CPPScope* klass, PyObject* bases, PyObject* dct, std::ostringstream& err)
-{
-// Scan all methods in dct and where it overloads base methods in klass, create
-// dispatchers on the C++ side. Then interject the dispatcher class.
-
-    if (!PyTuple_Check(bases) || !PyTuple_GET_SIZE(bases) || !dct || !PyDict_Check(dct)) {
-        err << "internal error: expected tuple of bases and proper dictionary";
-        return false;
-    }
+//----------------------------------------------------------------------------
+namespace {
 
-    if (!Utility::IncludePython()) {
-        err << "failed to include Python.h";
-        return false;
-    }
+// Dispatchers are generated with a placeholder for the class name, so that the code
+// identifies the dispatcher (it derives from the bases and overrides the methods) and
+// identical dispatchers can be shared between Python classes.
+const std::string kDispatcherName = "__cppyy_dispatcher__";
+
+struct DispatcherCode {
+    std::string           fKey;            // flags + code with placeholder name
+    std::string           fCode;
+    std::set<std::string> fProtected;      // names to expose on the Python side
+    unsigned int          fFlags;
+};
+
+struct DispatcherInfo {
+    Cppyy::TCppScope_t    fScope;
+    std::set<std::string> fProtected;
+};
+
+typedef std::map<std::string, DispatcherInfo> Dispatchers_t;
+Dispatchers_t gDispatchers;
+
+bool GenerateDispatcher(Cppyy::TCppType_t klassType, PyObject* bases,
+    const std::set<std::string>& attrs, std::set<std::string> clbs,
+    DispatcherCode& dc, std::ostringstream& err)
+{
+// Generate a dispatcher class deriving from all C++ bases, with dispatch methods for
+// those in 'attrs' (the attributes of the Python class) that override base methods.
+// Callables in 'clbs' not found in the direct bases, are searched for further up.
+    using namespace CPyCppyy;
 
 // collect all bases, error checking the hierarchy along the way
     const Py_ssize_t nBases = PyTuple_GET_SIZE(bases);
@@ -207,15 +237,16 @@ bool CPyCppyy::InsertDispatcher(CPPScope* klass, PyObject* bases, PyObject* dct,
             basetype, TypeManip::template_base(Cppyy::GetFinalName(basetype)), Cppyy::GetScopedFinalName(basetype));
     }
 
+    if (base_infos.empty()) {
+        if (err.str().empty()) err << "no C++ base class";
+        return false;
+    }
+
 // TODO: check deep hierarchy for multiple inheritance
-    bool isDeepHierarchy = klass->fCppType && base_infos.front().btype != klass->fCppType;
+    bool isDeepHierarchy = klassType && base_infos.front().btype != klassType;
 
-// once classes can be extended, should consider re-use; for now, since derived
-// python classes can differ in what they override, simply use different shims
-    static int counter = 0;
-    std::ostringstream osname;
-    osname << "Dispatcher" << ++counter;
-    const std::string& derivedName = osname.str();
+// the actual name is filled in once it is known that this dispatcher is new
+    const std::string& derivedName = kDispatcherName;
 
 // generate proxy class with the relevant method dispatchers
     std::ostringstream code;
@@ -236,7 +267,7 @@ bool CPyCppyy::InsertDispatcher(CPPScope* klass, PyObject* bases, PyObject* dct,
 // the conventional __destruct__ method (note that __del__ is always called, too, if
 // provided, but only when the Python object goes away; furthermore, if the Python
 // object goes before the C++ one, only __del__ is called)
-    if (PyMapping_HasKeyString(dct, (char*)"__destruct__")) {
+    if (attrs.find("__destruct__") != attrs.end()) {
         code << "  virtual ~" << derivedName << "() {\n"
                 "    PyObject* iself = (PyObject*)_internal_self;\n"
                 "    if (!iself || iself == Py_None)\n"
@@ -254,22 +285,13 @@ bool CPyCppyy::InsertDispatcher(CPPScope* klass, PyObject* bases, PyObject* dct,
     } else
         code << "  virtual ~" << derivedName << "() {}\n";
 
-// methods: first collect all callables, then get overrides from base classes, for
-// those that are still missing, search the hierarchy
-    PyObject* clbs = PyDict_New();
-    PyObject* items = PyDict_Items(dct);
-    for (Py_ssize_t i = 0; i < PyList_GET_SIZE(items); ++i) {
-        PyObject* value = PyTuple_GET_ITEM(PyList_GET_ITEM(items, i), 1);
-        if (PyCallable_Check(value))
-            PyDict_SetItem(clbs, PyTuple_GET_ITEM(PyList_GET_ITEM(items, i), 0), value);
-    }
-    Py_DECREF(items);
-    if (PyDict_DelItem(clbs, PyStrings::gInit) != 0)
-        PyErr_Clear();
+// methods: first get overrides from base classes, for the callables that are still
+// missing, search the hierarchy
+    clbs.erase("__init__");
 
 // protected methods and data need their access changed in the C++ trampoline and then
 // exposed on the Python side; so, collect their names as we go along
-    std::set<std::string> protected_names;
+    std::set<std::string>& protected_names = dc.fProtected;
 
 // simple case: methods from current class (collect constructors along the way)
     int has_default = 0, has_cctor = 0, has_ctors = 0, has_tmpl_ctors = 0;
@@ -298,12 +320,7 @@ bool CPyCppyy::InsertDispatcher(CPPScope* klass, PyObject* bases, PyObject* dct,
             }
 
             std::string mtCppName = Cppyy::GetMethodName(method);
-            PyObject* key = CPyCppyy_PyText_FromString(mtCppName.c_str());
-            int contains = PyDict_Contains(dct, key);
-            if (contains == -1) PyErr_Clear();
-            if (contains != 1) {
-                Py_DECREF(key);
-
+            if (attrs.find(mtCppName) == attrs.end()) {
             // if the method is protected, we expose it through re-declaration and forwarding (using
             // does not work here b/c there may be private overloads)
                 if (Cppyy::IsProtectedMethod(method)) {
@@ -328,11 +345,12 @@ bool CPyCppyy::InsertDispatcher(CPPScope* klass, PyObject* bases, PyObject* dct,
                 continue;
             }
 
-            InjectMethod(method, mtCppName, code);
-
-            if (PyDict_DelItem(clbs, key) != 0)
-                PyErr_Clear();        // happens for overloads
-            Py_DECREF(key);
+        // the base can be called directly if not overridden, as long as it is accessible
+        // and implemented (i.e. not pure virtual, which a concrete class can not have)
+            bool baseOk = !Cppyy::IsAbstract(binfo.btype) && !Cppyy::IsStaticMethod(method) && \
+                (Cppyy::IsPublicMethod(method) || Cppyy::IsProtectedMethod(method));
+            InjectMethod(method, mtCppName, code, baseOk ? binfo.bname : "");
+            clbs.erase(mtCppName);
         }
 
     // support for templated ctors in single inheritance (TODO: also multi possible?)
@@ -355,29 +373,24 @@ bool CPyCppyy::InsertDispatcher(CPPScope* klass, PyObject* bases, PyObject* dct,
 
 // try to locate left-overs in base classes
     for (const auto& binfo : base_infos) {
-        if (PyDict_Size(clbs)) {
+        if (!clbs.empty()) {
             size_t nbases = Cppyy::GetNumBases(binfo.btype);
             for (size_t ibase = 0; ibase < nbases; ++ibase) {
                 Cppyy::TCppScope_t tbase = (Cppyy::TCppScope_t)Cppyy::GetScope( \
                     Cppyy::GetBaseName(binfo.btype, ibase));
 
-                PyObject* keys = PyDict_Keys(clbs);
-                for (Py_ssize_t i = 0; i < PyList_GET_SIZE(keys); ++i) {
+                for (auto iclb = clbs.begin(); iclb != clbs.end();) {
                 // TODO: should probably invert this looping; but that makes handling overloads clunky
-                    PyObject* key = PyList_GET_ITEM(keys, i);
-                    std::string mtCppName = CPyCppyy_PyText_AsString(key);
+                    const std::string& mtCppName = *iclb;
                     const auto& v = FindBaseMethod(tbase, mtCppName);
                     for (auto idx : v)
                         InjectMethod(Cppyy::GetMethod(tbase, idx), mtCppName, code);
-                    if (!v.empty()) {
-                        if (PyDict_DelItem(clbs, key) != 0) PyErr_Clear();
-                    }
+                    if (!v.empty()) iclb = clbs.erase(iclb);
+                    else ++iclb;
                 }
-                Py_DECREF(keys);
             }
         }
     }
-    Py_DECREF(clbs);
 
 // constructors: build up from the argument types of the base class, for use by the Python
 // derived class (inheriting with/ "using" does not work b/c base class constructors may
@@ -456,33 +469,142 @@ bool CPyCppyy::InsertDispatcher(CPPScope* klass, PyObject* bases, PyObject* dct,
 // finish class declaration
     code << "};\n}";
 
-// finally, compile the code
-    if (!Cppyy::Compile(code.str())) {
-        err << "failed to compile the dispatcher code";
-        return false;
-    }
+    dc.fCode = code.str();
+    return true;
+}
 
-// keep track internally of the actual C++ type (this is used in
-// CPPConstructor to call the dispatcher's one instead of the base)
-    Cppyy::TCppScope_t disp = Cppyy::GetScope("__cppyy_internal::"+derivedName);
-    if (!disp) {
-        err << "failed to retrieve the internal dispatcher";
+//----------------------------------------------------------------------------
+bool RegisterDispatcher(const DispatcherCode& dc, const std::string& name)
+{
+// Locate a compiled dispatcher, create its proxy, and make it available for reuse.
+    Cppyy::TCppScope_t disp = Cppyy::GetScope("__cppyy_internal::"+name);
+    if (!disp)
         return false;
-    }
-    klass->fCppType = disp;
 
 // at this point, the dispatcher only lives in C++, as opposed to regular classes
 // that are part of the hierarchy in Python, so create it, which will cache it for
 // later use by e.g. the MemoryRegulator
+    PyObject* disp_proxy = CPyCppyy::CreateScopeProxy(disp, dc.fFlags);
+    if (!disp_proxy)
+        return false;
+    if (dc.fFlags) ((CPyCppyy::CPPScope*)disp_proxy)->fFlags |= CPyCppyy::CPPScope::kIsMultiCross;
+    ((CPyCppyy::CPPScope*)disp_proxy)->fFlags |= CPyCppyy::CPPScope::kIsPython;
+    Py_DECREF(disp_proxy);
+
+    gDispatchers[dc.fKey] = DispatcherInfo{disp, dc.fProtected};
+    return true;
+}
+
+void CompileDispatchers(const std::vector<const DispatcherCode*>& pending)
+{
+// Compile all new dispatchers in one go; if that fails, try them one by one so that
+// only the faulty ones are lost. Successfully compiled dispatchers are registered.
+    static int counter = 0;
+    std::vector<std::string> names; names.reserve(pending.size());
+    std::vector<std::string> codes; codes.reserve(pending.size());
+    for (auto dc : pending) {
+        names.push_back("Dispatcher" + std::to_string(++counter));
+        std::string code = dc->fCode;
+        for (std::string::size_type pos = code.find(kDispatcherName); pos != std::string::npos;
+                pos = code.find(kDispatcherName, pos + names.back().size()))
+            code.replace(pos, kDispatcherName.size(), names.back());
+        codes.push_back(std::move(code));
+    }
+
+    bool batchOk = false;
+    if (1 < pending.size()) {
+        std::string all;
+        for (const auto& code : codes) all += code + "\n";
+        batchOk = CPyCppyy::Utility::Compile(all, true /* silent */);
+    }
+
+    for (std::vector<const DispatcherCode*>::size_type i = 0; i < pending.size(); ++i) {
+        if (batchOk || CPyCppyy::Utility::Compile(codes[i]))
+            RegisterDispatcher(*pending[i], names[i]);
+    }
+}
+
+//----------------------------------------------------------------------------
+void CollectAttributes(PyObject* dct, std::set<std::string>& attrs, std::set<std::string>& clbs)
+{
+// Split out the names of all attributes in the Python class dictionary, and of the
+// callables among them.
+    PyObject* key = nullptr; PyObject* value = nullptr; Py_ssize_t pos = 0;
+    while (PyDict_Next(dct, &pos, &key, &value)) {
+        if (!CPyCppyy_PyText_Check(key))
+            continue;
+        const char* name = CPyCppyy_PyText_AsString(key);
+        attrs.insert(name);
+        if (PyCallable_Check(value))
+            clbs.insert(name);
+    }
+}
+
+bool PrepareDispatcher(Cppyy::TCppType_t klassType, unsigned int flags, PyObject* bases,
+    const std::set<std::string>& attrs, const std::set<std::string>& clbs,
+    DispatcherCode& dc, bool& isNew, std::ostringstream& err)
+{
+// Generate the dispatcher code and key, and check whether it still needs compiling.
+    if (!GenerateDispatcher(klassType, bases, attrs, clbs, dc, err))
+        return false;
+
+    dc.fFlags = flags;
+    dc.fKey   = std::to_string(flags) + ':' + dc.fCode;
+    isNew = gDispatchers.find(dc.fKey) == gDispatchers.end();
+    return true;
+}
+
+} // unnamed namespace
+
+//----------------------------------------------------------------------------
+bool CPyCppyy::InsertDispatcher(CPPScope* klass, PyObject* bases, PyObject* dct, std::ostringstream& err)
+{
+// Scan all methods in dct and where it overloads base methods in klass, create
+// dispatchers on the C++ side. Then interject the dispatcher class. Dispatchers
+// are shared between Python classes that override the same methods of the same
+// bases, so compilation only happens for new combinations.
+
+    if (!PyTuple_Check(bases) || !PyTuple_GET_SIZE(bases) || !dct || !PyDict_Check(dct)) {
+        err << "internal error: expected tuple of bases and proper dictionary";
+        return false;
+    }
+
+    if (!Utility::IncludePython()) {
+        err << "failed to include Python.h";
+        return false;
+    }
+
+    std::set<std::string> attrs, clbs;
+    CollectAttributes(dct, attrs, clbs);
+
+    DispatcherCode dc; bool isNew = false;
     unsigned int flags = (unsigned int)(klass->fFlags & CPPScope::kIsMultiCross);
-    PyObject* disp_proxy = CPyCppyy::CreateScopeProxy(disp, flags);
-    if (flags) ((CPPScope*)disp_proxy)->fFlags |= CPPScope::kIsMultiCross;
-    ((CPPScope*)disp_proxy)->fFlags |= CPPScope::kIsPython;
+    if (!PrepareDispatcher(klass->fCppType, flags, bases, attrs, clbs, dc, isNew, err))
+        return false;
+    if (isNew)
+        CompileDispatchers({&dc});
+
+    Dispatchers_t::iterator disp = gDispatchers.find(dc.fKey);
+    if (disp == gDispatchers.end()) {
+        err << "failed to compile the dispatcher code";
+        return false;
+    }
+
+// keep track internally of the actual C++ type (this is used in
+// CPPConstructor to call the dispatcher's one instead of the base)
+    klass->fCppType = disp->second.fScope;
 
 // finally, to expose protected members, copy them over from the C++ dispatcher base
 // to the Python dictionary (the C++ dispatcher's Python proxy is not a base of the
 // Python class to keep the inheritance tree intact)
-    for (const auto& name : protected_names) {
+    PyObject* disp_proxy = CreateScopeProxy(disp->second.fScope, flags);
+    if (!disp_proxy) {
+        err << "failed to retrieve the internal dispatcher";
+        return false;
+    }
+
+    for (const auto& name : disp->second.fProtected) {
+         CPyCppyy::MaterializeMethod(disp_proxy, name, false);
          PyObject* disp_dct = PyObject_GetAttr(disp_proxy, PyStrings::gDict);
          PyObject* pyf = PyMapping_GetItemString(disp_dct, (char*)name.c_str());
          if (pyf) {
@@ -492,7 +614,79 @@ bool CPyCppyy::InsertDispatcher(CPPScope* klass, PyObject* bases, PyObject* dct,
          Py_DECREF(disp_dct);
     }
 
-    Py_XDECREF(disp_proxy);
+    Py_DECREF(disp_proxy);
 
     return true;
 }
+
+//----------------------------------------------------------------------------
+PyObject* CPyCppyy::PrepareDispatchers(PyObject* specs)
+{
+// Generate the dispatchers for a list of (bases, method names) in one compilation,
+// for use by the Python classes that are subsequently derived. Returns the number
+// of dispatchers that were newly compiled.
+    if (!Utility::IncludePython()) {
+        PyErr_SetString(PyExc_RuntimeError, "failed to include Python.h");
+        return nullptr;
+    }
+
+    PyObject* seq = PySequence_Fast(specs, "expected a sequence of (bases, method names)");
+    if (!seq)
+        return nullptr;
+
+    std::vector<DispatcherCode> dcs(PySequence_Fast_GET_SIZE(seq));
+    std::vector<const DispatcherCode*> pending;
+    std::set<std::string> keys;
+    for (Py_ssize_t i = 0; i < (Py_ssize_t)dcs.size(); ++i) {
+        PyObject* bases = nullptr; PyObject* names = nullptr;
+        if (!PyArg_ParseTuple(PySequence_Fast_GET_ITEM(seq, i), const_cast<char*>("O!O"),
+                &PyTuple_Type, &bases, &names)) {
+            Py_DECREF(seq);
+            return nullptr;
+        }
+
+    // names are taken to be those of overridden methods
+        std::set<std::string> attrs;
+        PyObject* iter = PyObject_GetIter(names);
+        PyObject* item = nullptr;
+        while (iter && (item = PyIter_Next(iter))) {
+            if (CPyCppyy_PyText_Check(item))
+                attrs.insert(CPyCppyy_PyText_AsString(item));
+            Py_DECREF(item);
+        }
+        Py_XDECREF(iter);
+        if (PyErr_Occurred()) {
+            Py_DECREF(seq);
+            return nullptr;
+        }
+
+    // the class type is taken from the bases, as it would be from the meta class
+        Cppyy::TCppType_t klassType = 0;
+        for (Py_ssize_t ibase = 0; !klassType && ibase < PyTuple_GET_SIZE(bases); ++ibase) {
+            if (CPPScope_Check(PyTuple_GET_ITEM(bases, ibase)))
+                klassType = ((CPPScope*)PyTuple_GET_ITEM(bases, ibase))->fCppType;
+        }
+
+        unsigned int flags = 1 < PyTuple_GET_SIZE(bases) ? (unsigned int)CPPScope::kIsMultiCross : 0;
+        std::ostringstream err; bool isNew = false;
+        if (!PrepareDispatcher(klassType, flags, bases, attrs, attrs, dcs[i], isNew, err)) {
+            Py_DECREF(seq);
+            PyErr_Format(PyExc_TypeError, "no python-side overrides supported (%s)", err.str().c_str());
+            return nullptr;
+        }
+        if (isNew && keys.insert(dcs[i].fKey).second)
+            pending.push_back(&dcs[i]);
+    }
+    Py_DECREF(seq);
+
+    if (!pending.empty())
+        CompileDispatchers(pending);
+
+    long ncompiled = 0;
+    for (auto dc : pending) {
+        if (gDispatchers.find(dc->fKey) != gDispatchers.end())
+            ncompiled += 1;
+    }
+
+    return PyInt_FromLong(ncompiled);
+}
@@ -11,6 +11,9 @@ class CPPScope;
 // helper that inserts dispatchers for virtual methods
 bool InsertDispatcher(CPPScope* klass, PyObject* bases, PyObject* dct, std::ostringstream& err);
 
+// compile, in one go, the dispatchers for a list of (bases, method names)
+PyObject* PrepareDispatchers(PyObject* specs);
+
 } // namespace CPyCppyy
 
 #endif // !CPYCPPYY_DISPATCHER_H
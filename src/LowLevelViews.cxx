@@ -3,6 +3,7 @@
 #include "LowLevelViews.h"
 #include "Converters.h"
 #include "CustomPyTypes.h"
+#include "DLPack.h"
 #include "PyStrings.h"
 
 // Standard
@@ -59,6 +60,7 @@ static void ll_dealloc(CPyCppyy::LowLevelView* pyobj)
 // Destruction requires the deletion of the converter (if any)
     PyMem_Free(pyobj->fBufInfo.shape);
     PyMem_Free(pyobj->fBufInfo.strides);
+    PyMem_Free(pyobj->fBufInfo.suboffsets);
     if ((intptr_t)pyobj->fBufInfo.internal & CPyCppyy::LowLevelView::kIsOwner) {
        if ((intptr_t)pyobj->fBufInfo.internal & CPyCppyy::LowLevelView::kIsCppArray)
            delete [] pyobj->fBuf;
@@ -66,6 +68,11 @@ static void ll_dealloc(CPyCppyy::LowLevelView* pyobj)
            free(pyobj->fBuf);
     }
 
+    if ((intptr_t)pyobj->fBufInfo.internal & CPyCppyy::LowLevelView::kIsSubView) {
+        pyobj->fElemCnv = nullptr;      // owned by the parent view
+        pyobj->fConverter = nullptr;
+    }
+
     if (pyobj->fElemCnv != pyobj->fConverter &&\
             pyobj->fElemCnv && pyobj->fElemCnv->HasState())
         delete pyobj->fElemCnv;
@@ -73,6 +80,9 @@ static void ll_dealloc(CPyCppyy::LowLevelView* pyobj)
     if (pyobj->fConverter && pyobj->fConverter->HasState())
         delete pyobj->fConverter;
 
+// views into the memory of another object (e.g. field views) keep it alive
+    Py_XDECREF(pyobj->fBufInfo.obj);
+
     Py_TYPE(pyobj)->tp_free((PyObject*)pyobj);
 }
 
@@ -303,7 +313,8 @@ static void* ptr_from_tuple(CPyCppyy::LowLevelView* llview, PyObject* tup)
         if (!ptr)
             return nullptr;
 
-        if (!((intptr_t)view.internal & CPyCppyy::LowLevelView::kIsFixed) && dim != view.ndim-1)
+        if (!((intptr_t)view.internal & CPyCppyy::LowLevelView::kIsFixed) &&
+                !view.suboffsets && dim != view.ndim-1)
             ptr = *(char**)ptr;
     }
     return ptr;
@@ -319,19 +330,10 @@ static Py_ssize_t ll_length(CPyCppyy::LowLevelView* self)
 }
 
 //---------------------------------------------------------------------------
-static inline int init_slice(Py_buffer* base, PyObject* _key, int dim)
+static inline void shift_start(Py_buffer* base, int dim, Py_ssize_t start)
 {
-    Py_ssize_t start, stop, step, slicelength;
-
-#if PY_VERSION_HEX < 0x03000000
-    PySliceObject* key = (PySliceObject*)_key;
-#else
-    PyObject* key = _key;
-#endif
-
-    if (PySlice_GetIndicesEx(key, base->shape[dim], &start, &stop, &step, &slicelength) < 0)
-        return -1;
-
+// Move the start of the given dimension, which for indirect arrays means moving
+// the suboffset of the closest preceding indirect dimension.
     if (!base->suboffsets || dim == 0) {
     adjust_buf:
         base->buf = (char *)base->buf + base->strides[dim] * start;
@@ -344,6 +346,23 @@ static inline int init_slice(Py_buffer* base, PyObject* _key, int dim)
             goto adjust_buf; // all suboffsets are negative
         base->suboffsets[n] = base->suboffsets[n] + base->strides[dim] * start;
     }
+}
+
+//---------------------------------------------------------------------------
+static inline int init_slice(Py_buffer* base, PyObject* _key, int dim)
+{
+    Py_ssize_t start, stop, step, slicelength;
+
+#if PY_VERSION_HEX < 0x03000000
+    PySliceObject* key = (PySliceObject*)_key;
+#else
+    PyObject* key = _key;
+#endif
+
+    if (PySlice_GetIndicesEx(key, base->shape[dim], &start, &stop, &step, &slicelength) < 0)
+        return -1;
+
+    shift_start(base, dim, start);
     base->shape[dim] = slicelength;
     base->strides[dim] = base->strides[dim] * step;
 
@@ -383,6 +402,202 @@ static Py_ssize_t is_multiindex(PyObject* key)
     return 1;
 }
 
+//---------------------------------------------------------------------------
+static inline bool is_c_contiguous(const Py_buffer& view)
+{
+    if (view.suboffsets)
+        return false;
+
+    Py_ssize_t stride = view.itemsize;
+    for (Py_ssize_t idim = view.ndim-1; 0 <= idim; --idim) {
+        if (view.shape[idim] != 1 && view.strides[idim] != stride)
+            return false;
+        stride *= view.shape[idim];
+    }
+    return true;
+}
+
+//---------------------------------------------------------------------------
+static PyObject* ll_subview(CPyCppyy::LowLevelView* self, const Py_buffer& layout)
+{
+// Create a new view with the given layout on the memory of self, sharing (and
+// thus keeping alive) both the memory and the converters.
+    using namespace CPyCppyy;
+
+    if (layout.ndim == 0)
+        return self->fElemCnv->FromMemory(layout.buf);
+
+    PyObject* args = PyTuple_New(0);
+    LowLevelView* llp =
+        (LowLevelView*)LowLevelView_Type.tp_new(&LowLevelView_Type, args, nullptr);
+    Py_DECREF(args);
+    if (!llp)
+        return nullptr;
+
+    Py_buffer& view = llp->fBufInfo;
+    view = layout;
+    view.obj        = (PyObject*)self;
+    Py_INCREF(self);
+    view.shape      = (Py_ssize_t*)PyMem_Malloc(view.ndim * sizeof(Py_ssize_t));
+    view.strides    = (Py_ssize_t*)PyMem_Malloc(view.ndim * sizeof(Py_ssize_t));
+    view.len        = view.itemsize;
+    for (int idim = 0; idim < view.ndim; ++idim) {
+        view.shape[idim]   = layout.shape[idim];
+        view.strides[idim] = layout.strides[idim];
+        view.len *= view.shape[idim];
+    }
+    if (layout.suboffsets) {
+        view.suboffsets = (Py_ssize_t*)PyMem_Malloc(view.ndim * sizeof(Py_ssize_t));
+        for (int idim = 0; idim < view.ndim; ++idim)
+            view.suboffsets[idim] = layout.suboffsets[idim];
+    }
+
+    intptr_t flags = LowLevelView::kIsSubView;
+    flags |= (intptr_t)self->fBufInfo.internal & LowLevelView::kIsFixed;
+    if (!is_c_contiguous(view)) flags |= LowLevelView::kIsStrided;
+    (intptr_t&)view.internal = flags;
+
+// items of 1-dim views are elements; deeper views index through sub-views
+    llp->fConverter = view.ndim == 1 ? self->fElemCnv : self->fConverter;
+    llp->fElemCnv   = self->fElemCnv;
+
+    return (PyObject*)llp;
+}
+
+//---------------------------------------------------------------------------
+static bool init_layout(CPyCppyy::LowLevelView* self, Py_buffer& layout,
+    Py_ssize_t* shape, Py_ssize_t* strides, Py_ssize_t* suboffsets)
+{
+// Copy the current layout into the given (PyBUF_MAX_NDIM sized) arrays; multi-dim
+// arrays that are not fixed (i.e. pointer-to-pointer, which have an array converter
+// for their items) are described by dereferencing through suboffsets. Fixed multi-dim
+// arrays carry pointer-sized items for indexing, so use the element size instead.
+    using namespace CPyCppyy;
+
+    Py_buffer& view = self->fBufInfo;
+    if (PyBUF_MAX_NDIM < view.ndim) {
+        PyErr_SetString(PyExc_ValueError, "too many dimensions");
+        return false;
+    }
+
+    layout = view;
+    layout.buf = self->get_buf();
+    layout.shape = shape; layout.strides = strides; layout.suboffsets = nullptr;
+    bool isfix = (intptr_t)view.internal & LowLevelView::kIsFixed;
+    bool indirect = view.suboffsets ||
+        (!isfix && 1 < view.ndim && self->fConverter != self->fElemCnv);
+    if (indirect)
+        layout.suboffsets = suboffsets;
+    if (indirect || (isfix && 1 < view.ndim))
+        layout.itemsize = view.strides[view.ndim-1];
+    layout.len = layout.itemsize;
+    for (int idim = 0; idim < view.ndim; ++idim) {
+        shape[idim]   = view.shape[idim];
+        strides[idim] = view.strides[idim];
+        layout.len   *= shape[idim];
+        if (indirect) {
+            suboffsets[idim] = view.suboffsets ? view.suboffsets[idim] :\
+                (idim == view.ndim-1 ? -1 : 0);
+        }
+    }
+
+    return true;
+}
+
+//---------------------------------------------------------------------------
+static PyObject* ll_slice(CPyCppyy::LowLevelView* self, PyObject* key)
+{
+// Zero-copy slicing: key is a slice, index, or a tuple thereof, applied to the
+// leading dimensions in order; indices remove their dimension from the result.
+    using namespace CPyCppyy;
+
+    Py_buffer& view = self->fBufInfo;
+    if (!self->get_buf()) {
+        PyErr_SetString(PyExc_ReferenceError, "attempt to access a null-pointer");
+        return nullptr;
+    }
+
+    Py_ssize_t nkeys = PyTuple_Check(key) ? PyTuple_GET_SIZE(key) : 1;
+    if (view.ndim < nkeys) {
+        PyErr_Format(PyExc_TypeError,
+            "cannot index %d-dimension view with %zd-element tuple", view.ndim, nkeys);
+        return nullptr;
+    }
+
+    Py_buffer layout;
+    Py_ssize_t shape[PyBUF_MAX_NDIM], strides[PyBUF_MAX_NDIM], suboffsets[PyBUF_MAX_NDIM];
+    if (!init_layout(self, layout, shape, strides, suboffsets))
+        return nullptr;
+
+    bool drop[PyBUF_MAX_NDIM];
+    for (int idim = 0; idim < view.ndim; ++idim)
+        drop[idim] = false;
+
+    for (int idim = 0; idim < (int)nkeys; ++idim) {
+        PyObject* ikey = PyTuple_Check(key) ? PyTuple_GET_ITEM(key, idim) : key;
+        if (shape[idim] == UNKNOWN_SIZE || strides[idim] == UNKNOWN_SIZE) {
+            PyErr_Format(PyExc_IndexError,
+                "slicing not supported on dimension %d with unknown size", idim + 1);
+            return nullptr;
+        }
+
+        if (PySlice_Check(ikey)) {
+            if (init_slice(&layout, ikey, idim) < 0)
+                return nullptr;
+        } else if (PyIndex_Check(ikey)) {
+            Py_ssize_t index = PyNumber_AsSsize_t(ikey, PyExc_IndexError);
+            if (index == -1 && PyErr_Occurred())
+                return nullptr;
+            if (index < 0) index += shape[idim];
+            if (index < 0 || shape[idim] <= index) {
+                PyErr_Format(PyExc_IndexError,
+                    "index out of bounds on dimension %d", idim + 1);
+                return nullptr;
+            }
+            shift_start(&layout, idim, index);
+            shape[idim] = 1;
+            drop[idim] = true;
+        } else {
+            PyErr_SetString(PyExc_TypeError, "invalid slice key");
+            return nullptr;
+        }
+    }
+
+// remove indexed dimensions; leading indirect ones are resolved right away
+    int ndim = 0;
+    bool leading = true;
+    for (int idim = 0; idim < view.ndim; ++idim) {
+        bool hasptr = layout.suboffsets && suboffsets[idim] >= 0;
+        if (drop[idim]) {
+            if (hasptr) {
+                if (!leading) {
+                    PyErr_SetString(PyExc_NotImplementedError,
+                        "indexing of inner indirect dimensions is not implemented");
+                    return nullptr;
+                }
+                layout.buf = *(char**)layout.buf + suboffsets[idim];
+            }
+            continue;
+        }
+
+        leading = false;
+        shape[ndim] = shape[idim];
+        strides[ndim] = strides[idim];
+        if (layout.suboffsets) suboffsets[ndim] = suboffsets[idim];
+        ndim += 1;
+    }
+    layout.ndim = ndim;
+
+    if (layout.suboffsets) {
+        bool hasptr = false;
+        for (int idim = 0; idim < ndim; ++idim)
+            hasptr = hasptr || suboffsets[idim] >= 0;
+        if (!hasptr) layout.suboffsets = nullptr;
+    }
+
+    return ll_subview(self, layout);
+}
+
 
 // Return the item at index. In a one-dimensional view, this is an object
 // with the type specified by view->format. Otherwise, the item is a sub-view.
@@ -402,14 +617,18 @@ static PyObject* ll_item(CPyCppyy::LowLevelView* self, Py_ssize_t index)
         return nullptr;
     }
 
-    void* ptr = ptr_from_index(self, index);
-    if (ptr) {
-        bool isfix = (intptr_t)view.internal & CPyCppyy::LowLevelView::kIsFixed;
-        if (self->fBufInfo.ndim == 1 || !isfix)
-            return self->fConverter->FromMemory(ptr);
-        return self->fConverter->FromMemory((void*)&ptr);
+    bool isfix = (intptr_t)view.internal & CPyCppyy::LowLevelView::kIsFixed;
+    if (1 < view.ndim && (isfix || view.suboffsets)) {
+        PyObject* pyindex = PyInt_FromSsize_t(index);
+        PyObject* result = ll_slice(self, pyindex);
+        Py_DECREF(pyindex);
+        return result;
     }
 
+    void* ptr = ptr_from_index(self, index);
+    if (ptr)
+        return self->fConverter->FromMemory(ptr);
+
     return nullptr;      // error already set by lookup_dimension
 }
 
@@ -420,12 +639,8 @@ static PyObject* ll_item_multi(CPyCppyy::LowLevelView* self, PyObject *tup)
     Py_buffer& view = self->fBufInfo;
     Py_ssize_t nindices = PyTuple_GET_SIZE(tup);
 
-    if (nindices < view.ndim) {
-    // TODO: implement
-        PyErr_SetString(PyExc_NotImplementedError,
-                        "sub-views are not implemented");
-        return nullptr;
-    }
+    if (nindices < view.ndim)
+        return ll_slice(self, tup);
 
     void* ptr = ptr_from_tuple(self, tup);
 
@@ -466,47 +681,12 @@ static PyObject* ll_subscript(CPyCppyy::LowLevelView* self, PyObject* key)
             return nullptr;
         return ll_item(self, index);
     }
-    else if (PySlice_Check(key)) {
-        if (view.ndim == 1) {
-            Py_ssize_t start, stop, step, slicelen;
-            if (PySlice_Unpack(key, &start, &stop, &step) < 0)
-                return nullptr;
-
-            slicelen = PySlice_AdjustIndices(view.shape[0], &start, &stop, step);
-            if (slicelen <= 0)
-                slicelen = view.shape[0];
-
-            char* buf = (char*)self->get_buf();
-            char* slice_buf = new char[slicelen*view.itemsize];
-            size_t isize = view.itemsize;
-            for (size_t i=0, cur=0; i < (size_t)slicelen; cur += step, ++i) {
-                for (size_t j=0; j < isize; ++j)
-                    slice_buf[i*isize+j] = buf[(start+cur)*isize + j];
-            }
-
-            CPyCppyy::LowLevelView* ll = self->fCreator(slice_buf, {1, slicelen});
-            if (!ll)
-                delete [] slice_buf;
-            else
-                (intptr_t&)ll->fBufInfo.internal |= CPyCppyy::LowLevelView::kIsOwner;
-
-            return (PyObject*)ll;
-
-        } else {
-        // TODO: handle slicing. This should be simpler than the memoryview
-        // case as there is no Python object holding the buffer.
-             PyErr_SetString(PyExc_NotImplementedError,
-                "multi-dimensional slicing is not implemented");
-             return nullptr;
-        }
-    }
     else if (is_multiindex(key)) {
         return ll_item_multi(self, key);
     }
-    else if (is_multislice(key)) {
-        PyErr_SetString(PyExc_NotImplementedError,
-            "multi-dimensional slicing is not implemented");
-        return nullptr;
+    else if (PySlice_Check(key) || PyTuple_Check(key)) {
+    // slices, or tuples of slices and indices: results share memory with self
+        return ll_slice(self, key);
     }
 
     PyErr_SetString(PyExc_TypeError, "invalid slice key");
@@ -648,12 +828,30 @@ static int ll_getbuf(CPyCppyy::LowLevelView* self, Py_buffer* view, int flags)
         view->format = NULL;
     }
 
+    if ((flags & PyBUF_WRITABLE) && view->readonly) {
+        PyErr_SetString(PyExc_BufferError, "underlying buffer is not writable");
+        return -1;
+    }
+
     if ((flags & PyBUF_F_CONTIGUOUS) == PyBUF_F_CONTIGUOUS) {
         PyErr_SetString(PyExc_BufferError,
             "underlying buffer is not Fortran contiguous");
         return -1;
     }
 
+    if (((intptr_t)view->internal & CPyCppyy::LowLevelView::kIsStrided) &&
+            (flags & PyBUF_STRIDES) != PyBUF_STRIDES) {
+        PyErr_SetString(PyExc_BufferError,
+            "underlying buffer is not C-contiguous");
+        return -1;
+    }
+
+    if (view->suboffsets && (flags & PyBUF_INDIRECT) != PyBUF_INDIRECT) {
+        PyErr_SetString(PyExc_BufferError,
+            "underlying buffer requires suboffsets");
+        return -1;
+    }
+
     if (!(flags & PyBUF_FORMAT)) {
         /* PyBUF_SIMPLE or PyBUF_WRITABLE: at this point buf is C-contiguous,
            so base->buf = ndbuf->data. */
@@ -765,6 +963,11 @@ static PyObject* ll_reshape(CPyCppyy::LowLevelView* self, PyObject* shape)
 
     Py_buffer& view = self->fBufInfo;
 
+    if ((intptr_t)view.internal & CPyCppyy::LowLevelView::kIsStrided) {
+        PyErr_SetString(PyExc_TypeError, "can not reshape a strided view");
+        return nullptr;
+    }
+
 // verify size match
     Py_ssize_t oldsz = 0;
     for (Py_ssize_t idim = 0; idim < view.ndim; ++idim) {
@@ -856,6 +1059,24 @@ static PyObject* ll_array(CPyCppyy::LowLevelView* self, PyObject* args, PyObject
         if (!dtype)
             return nullptr;
 
+        if ((intptr_t)self->fBufInfo.internal & CPyCppyy::LowLevelView::kIsStrided) {
+        // frombuffer() requires contiguous memory, so go through a memoryview, which
+        // carries the strides, to still create the array without a copy
+            PyObject* mview = PyMemoryView_FromObject((PyObject*)self);
+            if (!mview) {
+                Py_DECREF(dtype);
+                return nullptr;
+            }
+
+            PyObject* npasarray = PyObject_GetAttr(npmod, CPyCppyy::PyStrings::gAsArray);
+            PyObject* view = PyObject_CallFunctionObjArgs(npasarray, mview, dtype, nullptr);
+            Py_DECREF(npasarray);
+            Py_DECREF(mview);
+            Py_DECREF(dtype);
+
+            return view;
+        }
+
         PyObject* npfrombuf = PyObject_GetAttr(npmod, CPyCppyy::PyStrings::gFromBuffer);
         PyObject* view = PyObject_CallFunctionObjArgs(npfrombuf, (PyObject*)self, dtype, nullptr);
         Py_DECREF(dtype);
@@ -882,7 +1103,8 @@ static PyObject* ll_as_string(CPyCppyy::LowLevelView* self)
 // Interpret memory as a null-terminated char string.
     Py_buffer& view = self->fBufInfo;
 
-    if (strcmp(view.format, "b") != 0 || view.ndim != 1) {
+    if (strcmp(view.format, "b") != 0 || view.ndim != 1 ||
+            ((intptr_t)view.internal & CPyCppyy::LowLevelView::kIsStrided)) {
         PyErr_Format(PyExc_TypeError,
             "as_string only supported for 1-dim char strings (format: %s, dim: %d)",
             view.format, (int)view.ndim);
@@ -894,6 +1116,744 @@ static PyObject* ll_as_string(CPyCppyy::LowLevelView* self)
     return CPyCppyy_PyText_FromStringAndSize(buf, sz);
 }
 
+//= numeric methods =========================================================
+// Reductions and updates for use without numpy. The innermost (contiguous) loops
+// are kept simple, so that the compiler can vectorize them; large arrays are
+// processed with the GIL released.
+static const Py_ssize_t LL_NOGIL_MINSIZE = 1 << 16;       // in elements
+
+namespace {
+
+template<typename F>
+void for_each_row(const Py_buffer& layout, char* ptr, int dim, F& f)
+{
+    if (layout.ndim == 0) {
+        f(ptr, 1, layout.itemsize);
+        return;
+    }
+
+    const Py_ssize_t n = layout.shape[dim], stride = layout.strides[dim];
+    if (dim == layout.ndim-1) {
+        f(ptr, n, stride);
+        return;
+    }
+
+    for (Py_ssize_t i = 0; i < n; ++i, ptr += stride)
+        for_each_row(layout, ADJUST_PTR(ptr, layout.suboffsets, dim), dim+1, f);
+}
+
+template<typename F>
+void run_rows(const Py_buffer& layout, Py_ssize_t nitems, F& f)
+{
+    if (nitems < LL_NOGIL_MINSIZE)
+        for_each_row(layout, (char*)layout.buf, 0, f);
+    else {
+        Py_BEGIN_ALLOW_THREADS
+        for_each_row(layout, (char*)layout.buf, 0, f);
+        Py_END_ALLOW_THREADS
+    }
+}
+
+// accumulator types for summation and scaling, and their Python conversions
+static bool int_factor(PyObject* pyobj, long long& a) {
+// integer views are scaled in integer arithmetic, so silent truncation is not an option
+    if (!PyIndex_Check(pyobj)) {
+        PyErr_Format(PyExc_TypeError,
+            "integer views require an integer factor (got %s)", Py_TYPE(pyobj)->tp_name);
+        return false;
+    }
+    PyObject* pyidx = PyNumber_Index(pyobj);
+    if (!pyidx)
+        return false;
+    a = PyLong_AsLongLong(pyidx);
+    Py_DECREF(pyidx);
+    return !(a == -1 && PyErr_Occurred());
+}
+
+template<typename T> struct acc_traits {
+    typedef long long acc_t;
+    static PyObject* to_py(acc_t a) { return PyLong_FromLongLong(a); }
+    static bool from_py(PyObject* pyobj, acc_t& a) { return int_factor(pyobj, a); }
+};
+
+#define CPPYY_LL_UNSIGNED_ACC(type)                                          \
+template<> struct acc_traits<type> {                                         \
+    typedef unsigned long long acc_t;                                        \
+    static PyObject* to_py(acc_t a) { return PyLong_FromUnsignedLongLong(a); }\
+    static bool from_py(PyObject* pyobj, acc_t& a) {  /* signed, for scaling */\
+        return int_factor(pyobj, (long long&)a);                             \
+    }                                                                        \
+}
+
+CPPYY_LL_UNSIGNED_ACC(unsigned char);
+CPPYY_LL_UNSIGNED_ACC(unsigned short);
+CPPYY_LL_UNSIGNED_ACC(unsigned int);
+CPPYY_LL_UNSIGNED_ACC(unsigned long);
+CPPYY_LL_UNSIGNED_ACC(unsigned long long);
+
+#define CPPYY_LL_FLOAT_ACC(type, acc)                                        \
+template<> struct acc_traits<type> {                                         \
+    typedef acc acc_t;                                                       \
+    static PyObject* to_py(acc_t a) { return PyFloat_FromDouble((double)a); }\
+    static bool from_py(PyObject* pyobj, acc_t& a) {                         \
+        a = (acc_t)PyFloat_AsDouble(pyobj);                                  \
+        return !(a == (acc_t)-1 && PyErr_Occurred());                        \
+    }                                                                        \
+}
+
+CPPYY_LL_FLOAT_ACC(float,       double);
+CPPYY_LL_FLOAT_ACC(double,      double);
+CPPYY_LL_FLOAT_ACC(long double, long double);
+
+template<typename T> struct acc_traits<std::complex<T>> {
+    typedef std::complex<double> acc_t;
+    static PyObject* to_py(acc_t a) { return PyComplex_FromDoubles(a.real(), a.imag()); }
+};
+
+template<typename A, typename T>
+inline A acc_cast(const T& v) { return (A)v; }
+template<typename A, typename T>
+inline A acc_cast(const std::complex<T>& v) { return A((double)v.real(), (double)v.imag()); }
+
+// row kernels
+template<typename T>
+struct SumRow {
+    typedef typename acc_traits<T>::acc_t acc_t;
+    acc_t fSum{};
+    void operator()(char* ptr, Py_ssize_t n, Py_ssize_t stride) {
+        if (stride == (Py_ssize_t)sizeof(T)) {
+        // independent partial sums, to break the dependency chain
+            const T* p = (const T*)ptr;
+            acc_t s0{}, s1{}, s2{}, s3{};
+            Py_ssize_t i = 0;
+            for (; i+4 <= n; i += 4) {
+                s0 += acc_cast<acc_t>(p[i]);   s1 += acc_cast<acc_t>(p[i+1]);
+                s2 += acc_cast<acc_t>(p[i+2]); s3 += acc_cast<acc_t>(p[i+3]);
+            }
+            for (; i < n; ++i)
+                s0 += acc_cast<acc_t>(p[i]);
+            fSum += (s0 + s1) + (s2 + s3);
+        } else {
+            for (Py_ssize_t i = 0; i < n; ++i, ptr += stride)
+                fSum += acc_cast<acc_t>(*(const T*)ptr);
+        }
+    }
+};
+
+template<typename T, bool IsMax>
+struct ExtremeRow {
+    T fBest{};
+    bool fFound = false;
+    void operator()(char* ptr, Py_ssize_t n, Py_ssize_t stride) {
+        if (n <= 0) return;
+        T best = fFound ? fBest : *(const T*)ptr;
+        if (stride == (Py_ssize_t)sizeof(T)) {
+            const T* p = (const T*)ptr;
+            for (Py_ssize_t i = 0; i < n; ++i)
+                best = IsMax ? (best < p[i] ? p[i] : best) : (p[i] < best ? p[i] : best);
+        } else {
+            for (Py_ssize_t i = 0; i < n; ++i, ptr += stride) {
+                const T& v = *(const T*)ptr;
+                best = IsMax ? (best < v ? v : best) : (v < best ? v : best);
+            }
+        }
+        fBest = best;
+        fFound = true;
+    }
+};
+
+template<typename T>
+struct FillRow {
+    T fValue;
+    void operator()(char* ptr, Py_ssize_t n, Py_ssize_t stride) {
+        if (stride == (Py_ssize_t)sizeof(T)) {
+            T* p = (T*)ptr;
+            for (Py_ssize_t i = 0; i < n; ++i)
+                p[i] = fValue;
+        } else {
+            for (Py_ssize_t i = 0; i < n; ++i, ptr += stride)
+                *(T*)ptr = fValue;
+        }
+    }
+};
+
+template<typename T>
+struct ScaleRow {
+    typedef typename acc_traits<T>::acc_t acc_t;
+    acc_t fFactor;
+    void operator()(char* ptr, Py_ssize_t n, Py_ssize_t stride) {
+        if (stride == (Py_ssize_t)sizeof(T)) {
+            T* p = (T*)ptr;
+            for (Py_ssize_t i = 0; i < n; ++i)
+                p[i] = (T)(p[i] * fFactor);
+        } else {
+            for (Py_ssize_t i = 0; i < n; ++i, ptr += stride)
+                *(T*)ptr = (T)(*(T*)ptr * fFactor);
+        }
+    }
+};
+
+struct CopyRow {
+    const char* fSrc;
+    Py_ssize_t  fItemSize;
+    void operator()(char* ptr, Py_ssize_t n, Py_ssize_t stride) {
+        if (stride == fItemSize)
+            memmove(ptr, fSrc, n*fItemSize);
+        else {
+            for (Py_ssize_t i = 0; i < n; ++i, ptr += stride)
+                memcpy(ptr, fSrc + i*fItemSize, fItemSize);
+        }
+        fSrc += n*fItemSize;
+    }
+};
+
+// operations, per element type; the default is for types not supporting them
+enum ENumOp { kSum, kMin, kMax, kFill, kScale };
+
+PyObject* unsupported(const char* opname)
+{
+    PyErr_Format(PyExc_TypeError, "%s not supported for this element type", opname);
+    return nullptr;
+}
+
+template<typename T>
+PyObject* ll_sum(const Py_buffer& layout, Py_ssize_t nitems) {
+    SumRow<T> f;
+    run_rows(layout, nitems, f);
+    return acc_traits<T>::to_py(f.fSum);
+}
+
+template<typename T, bool IsMax>
+PyObject* ll_extreme(CPyCppyy::LowLevelView* self, const Py_buffer& layout, Py_ssize_t nitems) {
+    if (!nitems) {
+        PyErr_SetString(PyExc_ValueError, "arg is an empty sequence");
+        return nullptr;
+    }
+    ExtremeRow<T, IsMax> f;
+    run_rows(layout, nitems, f);
+    return self->fElemCnv->FromMemory(&f.fBest);
+}
+
+template<typename T>
+PyObject* ll_fill(CPyCppyy::LowLevelView* self, const Py_buffer& layout, Py_ssize_t nitems, PyObject* value) {
+    FillRow<T> f;
+    if (!self->fElemCnv->ToMemory(value, &f.fValue))
+        return nullptr;
+    run_rows(layout, nitems, f);
+    Py_RETURN_NONE;
+}
+
+template<typename T>
+PyObject* ll_scale(const Py_buffer& layout, Py_ssize_t nitems, PyObject* factor) {
+    ScaleRow<T> f;
+    if (!acc_traits<T>::from_py(factor, f.fFactor))
+        return nullptr;
+    run_rows(layout, nitems, f);
+    Py_RETURN_NONE;
+}
+
+template<typename T>
+struct NumOp {
+    static PyObject* run(CPyCppyy::LowLevelView* self,
+            const Py_buffer& layout, Py_ssize_t nitems, ENumOp op, PyObject* arg) {
+        switch (op) {
+        case kSum:   return ll_sum<T>(layout, nitems);
+        case kMin:   return ll_extreme<T, false>(self, layout, nitems);
+        case kMax:   return ll_extreme<T, true>(self, layout, nitems);
+        case kFill:  return ll_fill<T>(self, layout, nitems, arg);
+        case kScale: return ll_scale<T>(layout, nitems, arg);
+        }
+        return nullptr;
+    }
+};
+
+template<>
+struct NumOp<bool> {
+    static PyObject* run(CPyCppyy::LowLevelView* self,
+            const Py_buffer& layout, Py_ssize_t nitems, ENumOp op, PyObject* arg) {
+        if (op == kScale) return unsupported("scale");
+        if (op == kSum) {
+            SumRow<unsigned char> f;     // bool is stored as a single 0/1 byte
+            run_rows(layout, nitems, f);
+            return PyLong_FromUnsignedLongLong(f.fSum);
+        }
+        return NumOp<unsigned char>::run(self, layout, nitems, op, arg);
+    }
+};
+
+template<typename T>
+struct NumOp<std::complex<T>> {
+    static PyObject* run(CPyCppyy::LowLevelView* self,
+            const Py_buffer& layout, Py_ssize_t nitems, ENumOp op, PyObject* arg) {
+        switch (op) {
+        case kSum:   return ll_sum<std::complex<T>>(layout, nitems);
+        case kFill:  return ll_fill<std::complex<T>>(self, layout, nitems, arg);
+        case kMin:   return unsupported("min");
+        case kMax:   return unsupported("max");
+        case kScale: return unsupported("scale");
+        }
+        return nullptr;
+    }
+};
+
+} // unnamed namespace
+
+//---------------------------------------------------------------------------
+static Py_ssize_t ll_numeric_layout(CPyCppyy::LowLevelView* self, Py_buffer& layout,
+    Py_ssize_t* shape, Py_ssize_t* strides, Py_ssize_t* suboffsets, bool write)
+{
+// Verify that the view can be traversed and return the total number of items;
+// empty views (e.g. of empty vectors) may have a null buffer.
+    using namespace CPyCppyy;
+
+    bool empty = false;
+    for (int idim = 0; idim < self->fBufInfo.ndim; ++idim)
+        empty = empty || self->fBufInfo.shape[idim] == 0;
+    if (!self->get_buf() && !empty) {
+        PyErr_SetString(PyExc_ReferenceError, "attempt to access a null-pointer");
+        return -1;
+    }
+
+    if (write && self->fBufInfo.readonly) {
+        PyErr_SetString(PyExc_TypeError, "cannot modify read-only memory");
+        return -1;
+    }
+
+    if (!init_layout(self, layout, shape, strides, suboffsets))
+        return -1;
+
+    if (0 < layout.ndim) {
+        Py_ssize_t last = layout.ndim-1;
+        if ((layout.suboffsets && 0 <= layout.suboffsets[last]) || (!layout.suboffsets &&\
+                !((intptr_t)layout.internal & LowLevelView::kIsStrided) && layout.strides[last] != layout.itemsize)) {
+            PyErr_SetString(PyExc_TypeError, "unsupported memory layout");
+            return -1;
+        }
+    }
+
+    Py_ssize_t nitems = 1;
+    for (int idim = 0; idim < layout.ndim; ++idim) {
+        if (layout.shape[idim] == UNKNOWN_SIZE || layout.shape[idim] == INT_MAX/layout.itemsize) {
+            PyErr_SetString(PyExc_ValueError, "array size unknown; use reshape() to set it");
+            return -1;
+        }
+        nitems *= layout.shape[idim];
+    }
+
+    return nitems;
+}
+
+//---------------------------------------------------------------------------
+static PyObject* ll_numeric(CPyCppyy::LowLevelView* self, ENumOp op, PyObject* arg)
+{
+// Dispatch the operation on the element type, as given by the format.
+    Py_buffer layout;
+    Py_ssize_t shape[PyBUF_MAX_NDIM], strides[PyBUF_MAX_NDIM], suboffsets[PyBUF_MAX_NDIM];
+    Py_ssize_t nitems = ll_numeric_layout(
+        self, layout, shape, strides, suboffsets, op == kFill || op == kScale);
+    if (nitems < 0)
+        return nullptr;
+
+    const char* fmt = layout.format;
+    const Py_ssize_t isz = layout.itemsize;
+#define CPPYY_LL_NUMOP(code, type)                                           \
+    if (strcmp(fmt, code) == 0 && isz == (Py_ssize_t)sizeof(type))           \
+        return NumOp<type>::run(self, layout, nitems, op, arg)
+
+    CPPYY_LL_NUMOP("?",  bool);
+    CPPYY_LL_NUMOP("b",  signed char);
+    CPPYY_LL_NUMOP("B",  unsigned char);
+    CPPYY_LL_NUMOP("h",  short);
+    CPPYY_LL_NUMOP("H",  unsigned short);
+    CPPYY_LL_NUMOP("i",  int);
+    CPPYY_LL_NUMOP("I",  unsigned int);
+    CPPYY_LL_NUMOP("l",  long);
+    CPPYY_LL_NUMOP("L",  unsigned long);
+    CPPYY_LL_NUMOP("q",  long long);
+    CPPYY_LL_NUMOP("Q",  unsigned long long);
+    CPPYY_LL_NUMOP("f",  float);
+    CPPYY_LL_NUMOP("d",  double);
+    CPPYY_LL_NUMOP("D",  long double);
+    CPPYY_LL_NUMOP("Zf", std::complex<float>);
+    CPPYY_LL_NUMOP("Zd", std::complex<double>);
+    CPPYY_LL_NUMOP("Zi", std::complex<int>);
+    CPPYY_LL_NUMOP("Zl", std::complex<long>);
+
+#undef CPPYY_LL_NUMOP
+
+    PyErr_Format(PyExc_TypeError, "unsupported element type (format: %s)", fmt);
+    return nullptr;
+}
+
+//---------------------------------------------------------------------------
+static PyObject* ll_sum_m(CPyCppyy::LowLevelView* self)
+{
+    return ll_numeric(self, kSum, nullptr);
+}
+
+static PyObject* ll_min_m(CPyCppyy::LowLevelView* self)
+{
+    return ll_numeric(self, kMin, nullptr);
+}
+
+static PyObject* ll_max_m(CPyCppyy::LowLevelView* self)
+{
+    return ll_numeric(self, kMax, nullptr);
+}
+
+static PyObject* ll_fill_m(CPyCppyy::LowLevelView* self, PyObject* value)
+{
+    return ll_numeric(self, kFill, value);
+}
+
+static PyObject* ll_scale_m(CPyCppyy::LowLevelView* self, PyObject* factor)
+{
+    return ll_numeric(self, kScale, factor);
+}
+
+//---------------------------------------------------------------------------
+static char ll_format_kind(const char* fmt)
+{
+// Classify a (single item) struct format, for lenient matching of equally sized
+// types (e.g. 'l' and 'q' on 64b Linux).
+    if (!fmt) return 'u';    // unsigned bytes
+    if (*fmt == '@' || *fmt == '=') fmt += 1;
+    if (fmt[0] == 'Z') return 'c';
+    if (fmt[1] != '\0') return '\0';
+    if (strchr("bhilq", fmt[0])) return 'i';
+    if (strchr("BHILQ", fmt[0])) return 'u';
+    if (strchr("efdgD", fmt[0])) return 'f';
+    if (fmt[0] == '?') return '?';
+    return '\0';
+}
+
+static PyObject* ll_copy_from(CPyCppyy::LowLevelView* self, PyObject* source)
+{
+// Copy the items from a buffer of the same item type and number of items.
+    Py_buffer layout;
+    Py_ssize_t shape[PyBUF_MAX_NDIM], strides[PyBUF_MAX_NDIM], suboffsets[PyBUF_MAX_NDIM];
+    Py_ssize_t nitems = ll_numeric_layout(self, layout, shape, strides, suboffsets, true);
+    if (nitems < 0)
+        return nullptr;
+
+    Py_buffer src;
+    memset(&src, 0, sizeof(Py_buffer));
+    if (PyObject_GetBuffer(source, &src, PyBUF_FULL_RO) < 0)
+        return nullptr;
+
+    const char kind = ll_format_kind(layout.format);
+    if (src.itemsize != layout.itemsize || !kind || kind != ll_format_kind(src.format)) {
+        PyErr_Format(PyExc_TypeError, "buffer item type (format: %s, size: %d) does not match "
+            "(format: %s, size: %d)", src.format ? src.format : "B", (int)src.itemsize,
+            layout.format, (int)layout.itemsize);
+        CPyCppyy_PyBuffer_Release(source, &src);
+        return nullptr;
+    }
+
+    if (src.len != nitems*layout.itemsize) {
+        PyErr_Format(PyExc_ValueError, "buffer has %zd items, expected %zd",
+            src.len/src.itemsize, nitems);
+        CPyCppyy_PyBuffer_Release(source, &src);
+        return nullptr;
+    }
+
+    char* mem = nullptr;
+    if (!PyBuffer_IsContiguous(&src, 'C')) {
+        mem = (char*)PyMem_Malloc(src.len);
+        if (!mem || PyBuffer_ToContiguous(mem, &src, src.len, 'C') < 0) {
+            if (!mem) PyErr_NoMemory();
+            PyMem_Free(mem);
+            CPyCppyy_PyBuffer_Release(source, &src);
+            return nullptr;
+        }
+    }
+
+    CopyRow f{mem ? mem : (const char*)src.buf, layout.itemsize};
+    run_rows(layout, nitems, f);
+
+    PyMem_Free(mem);
+    CPyCppyy_PyBuffer_Release(source, &src);
+
+    Py_RETURN_NONE;
+}
+
+//= bulk conversions ========================================================
+// Conversions of all items in a single pass, without going through the iterator
+// protocol and item lookup; numbers are boxed directly, other types (such as
+// chars and strings, which share the "b" format) use the element converter.
+namespace {
+
+typedef PyObject* (*box_t)(CPyCppyy::LowLevelView*, char*);
+
+template<typename T>
+PyObject* box_long(CPyCppyy::LowLevelView*, char* ptr) {
+    return PyLong_FromLong((long)*(T*)ptr);
+}
+
+template<typename T>
+PyObject* box_ulong(CPyCppyy::LowLevelView*, char* ptr) {
+    return PyLong_FromUnsignedLong((unsigned long)*(T*)ptr);
+}
+
+PyObject* box_longlong(CPyCppyy::LowLevelView*, char* ptr) {
+    return PyLong_FromLongLong(*(long long*)ptr);
+}
+
+PyObject* box_ulonglong(CPyCppyy::LowLevelView*, char* ptr) {
+    return PyLong_FromUnsignedLongLong(*(unsigned long long*)ptr);
+}
+
+PyObject* box_bool(CPyCppyy::LowLevelView*, char* ptr) {
+    return PyBool_FromLong((long)*(bool*)ptr);
+}
+
+template<typename T>
+PyObject* box_float(CPyCppyy::LowLevelView*, char* ptr) {
+    return PyFloat_FromDouble((double)*(T*)ptr);
+}
+
+template<typename T>
+PyObject* box_complex(CPyCppyy::LowLevelView*, char* ptr) {
+    const std::complex<T>& c = *(std::complex<T>*)ptr;
+    return PyComplex_FromDoubles((double)c.real(), (double)c.imag());
+}
+
+PyObject* box_converter(CPyCppyy::LowLevelView* self, char* ptr) {
+    return self->fElemCnv->FromMemory(ptr);
+}
+
+box_t select_box(const char* fmt, Py_ssize_t isz)
+{
+#define CPPYY_LL_BOX(code, type, box)                                        \
+    if (strcmp(fmt, code) == 0 && isz == (Py_ssize_t)sizeof(type))           \
+        return box
+
+    CPPYY_LL_BOX("?",  bool,                 box_bool);
+    CPPYY_LL_BOX("B",  unsigned char,        box_long<unsigned char>);
+    CPPYY_LL_BOX("h",  short,                box_long<short>);
+    CPPYY_LL_BOX("H",  unsigned short,       box_long<unsigned short>);
+    CPPYY_LL_BOX("i",  int,                  box_long<int>);
+    CPPYY_LL_BOX("I",  unsigned int,         box_ulong<unsigned int>);
+    CPPYY_LL_BOX("l",  long,                 box_long<long>);
+    CPPYY_LL_BOX("L",  unsigned long,        box_ulong<unsigned long>);
+    CPPYY_LL_BOX("q",  long long,            box_longlong);
+    CPPYY_LL_BOX("Q",  unsigned long long,   box_ulonglong);
+    CPPYY_LL_BOX("f",  float,                box_float<float>);
+    CPPYY_LL_BOX("d",  double,               box_float<double>);
+    CPPYY_LL_BOX("D",  long double,          box_float<long double>);
+    CPPYY_LL_BOX("Zf", std::complex<float>,  box_complex<float>);
+    CPPYY_LL_BOX("Zd", std::complex<double>, box_complex<double>);
+
+#undef CPPYY_LL_BOX
+
+    return box_converter;
+}
+
+PyObject* build_list(CPyCppyy::LowLevelView* self,
+    const Py_buffer& layout, char* ptr, int dim, box_t box)
+{
+    if (layout.ndim == 0)
+        return box(self, ptr);
+
+    const Py_ssize_t n = layout.shape[dim], stride = layout.strides[dim];
+    PyObject* result = PyList_New(n);
+    if (!result)
+        return nullptr;
+
+    for (Py_ssize_t i = 0; i < n; ++i, ptr += stride) {
+        PyObject* item = (dim == layout.ndim-1) ? box(self, ptr) :
+            build_list(self, layout, ADJUST_PTR(ptr, layout.suboffsets, dim), dim+1, box);
+        if (!item) {
+            Py_DECREF(result);
+            return nullptr;
+        }
+        PyList_SET_ITEM(result, i, item);
+    }
+
+    return result;
+}
+
+struct GatherRow {
+    char*       fDest;
+    Py_ssize_t  fItemSize;
+    void operator()(char* ptr, Py_ssize_t n, Py_ssize_t stride) {
+        if (stride == fItemSize)
+            memcpy(fDest, ptr, n*fItemSize);
+        else {
+            for (Py_ssize_t i = 0; i < n; ++i, ptr += stride)
+                memcpy(fDest + i*fItemSize, ptr, fItemSize);
+        }
+        fDest += n*fItemSize;
+    }
+};
+
+} // unnamed namespace
+
+//---------------------------------------------------------------------------
+static PyObject* ll_tolist(CPyCppyy::LowLevelView* self)
+{
+// Return the items as a (nested, for multi-dim views) list.
+    Py_buffer layout;
+    Py_ssize_t shape[PyBUF_MAX_NDIM], strides[PyBUF_MAX_NDIM], suboffsets[PyBUF_MAX_NDIM];
+    if (ll_numeric_layout(self, layout, shape, strides, suboffsets, false) < 0)
+        return nullptr;
+
+    return build_list(self, layout, (char*)layout.buf, 0, select_box(layout.format, layout.itemsize));
+}
+
+//---------------------------------------------------------------------------
+static PyObject* ll_tobytes(CPyCppyy::LowLevelView* self)
+{
+// Return a copy of the memory, with the items in C (row-major) order.
+    Py_buffer layout;
+    Py_ssize_t shape[PyBUF_MAX_NDIM], strides[PyBUF_MAX_NDIM], suboffsets[PyBUF_MAX_NDIM];
+    Py_ssize_t nitems = ll_numeric_layout(self, layout, shape, strides, suboffsets, false);
+    if (nitems < 0)
+        return nullptr;
+
+    PyObject* result = PyBytes_FromStringAndSize(nullptr, nitems*layout.itemsize);
+    if (!result)
+        return nullptr;
+
+    GatherRow f{PyBytes_AS_STRING(result), layout.itemsize};
+    run_rows(layout, nitems, f);
+    return result;
+}
+
+
+//= DLPack protocol =========================================================
+namespace {
+
+struct DLPackContext {
+    CPyCppyy::DLPack::DLManagedTensor fTensor;
+    PyObject* fOwner;
+    int64_t   fDims[2*PyBUF_MAX_NDIM];   // shape, followed by strides
+};
+
+void ll_dlpack_deleter(CPyCppyy::DLPack::DLManagedTensor* tensor)
+{
+// Called by the consumer, possibly without holding the GIL.
+    DLPackContext* ctx = (DLPackContext*)tensor->manager_ctx;
+    if (Py_IsInitialized()) {
+        PyGILState_STATE state = PyGILState_Ensure();
+        Py_XDECREF(ctx->fOwner);
+        PyGILState_Release(state);
+    }
+    delete ctx;
+}
+
+void ll_dlpack_capsule_destructor(PyObject* capsule)
+{
+// Capsules that were not consumed still own the tensor.
+    using namespace CPyCppyy;
+    if (!PyCapsule_IsValid(capsule, DLPack::kCapsuleName))
+        return;
+
+    PyObject *type, *value, *traceback;
+    PyErr_Fetch(&type, &value, &traceback);
+    DLPack::DLManagedTensor* tensor =
+        (DLPack::DLManagedTensor*)PyCapsule_GetPointer(capsule, DLPack::kCapsuleName);
+    if (tensor && tensor->deleter)
+        tensor->deleter(tensor);
+    PyErr_Restore(type, value, traceback);
+}
+
+} // unnamed namespace
+
+//---------------------------------------------------------------------------
+static PyObject* ll_dlpack(CPyCppyy::LowLevelView* self, PyObject* args, PyObject* kwds)
+{
+// Export as a (legacy, unversioned) DLPack capsule; only CPU memory is available,
+// so a stream is meaningless and copies are never made.
+    using namespace CPyCppyy;
+
+    static const char* kwlist[] = {"stream", "max_version", "dl_device", "copy", nullptr};
+    PyObject *stream = nullptr, *max_version = nullptr, *dl_device = nullptr, *copy = nullptr;
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, const_cast<char*>("|OOOO:__dlpack__"),
+            const_cast<char**>(kwlist), &stream, &max_version, &dl_device, &copy))
+        return nullptr;
+
+    if (stream && stream != Py_None) {
+        PyErr_SetString(PyExc_ValueError, "stream must be None for CPU memory");
+        return nullptr;
+    }
+
+    if (copy && PyObject_IsTrue(copy)) {
+        PyErr_SetString(PyExc_BufferError, "copies are not supported");
+        return nullptr;
+    }
+
+    Py_buffer layout;
+    Py_ssize_t shape[PyBUF_MAX_NDIM], strides[PyBUF_MAX_NDIM], suboffsets[PyBUF_MAX_NDIM];
+    if (ll_numeric_layout(self, layout, shape, strides, suboffsets, false) < 0)
+        return nullptr;
+
+    if (layout.suboffsets) {
+        PyErr_SetString(PyExc_BufferError, "indirect arrays can not be exported");
+        return nullptr;
+    }
+
+// element type from the format
+    DLPack::DLDataType dtype;
+    dtype.bits  = (uint8_t)(8*layout.itemsize);
+    dtype.lanes = 1;
+    const char* fmt = layout.format;
+    if (strcmp(fmt, "?") == 0)
+        dtype.code = DLPack::kDLBool;
+    else if (fmt[1] == '\0' && strchr("bhilq", fmt[0]))
+        dtype.code = DLPack::kDLInt;
+    else if (fmt[1] == '\0' && strchr("BHILQ", fmt[0]))
+        dtype.code = DLPack::kDLUInt;
+    else if (strcmp(fmt, "f") == 0 || strcmp(fmt, "d") == 0)
+        dtype.code = DLPack::kDLFloat;
+    else if (strcmp(fmt, "Zf") == 0 || strcmp(fmt, "Zd") == 0)
+        dtype.code = DLPack::kDLComplex;
+    else {
+        PyErr_Format(PyExc_BufferError, "unsupported element type (format: %s)", fmt);
+        return nullptr;
+    }
+
+// consumers may reject a null data pointer, even if there are no items
+    static char sEmpty = 0;
+    DLPackContext* ctx = new DLPackContext{};
+    DLPack::DLTensor& dl = ctx->fTensor.dl_tensor;
+    dl.data               = layout.buf ? layout.buf : &sEmpty;
+    dl.device.device_type = DLPack::kDLCPU;
+    dl.device.device_id   = 0;
+    dl.ndim               = layout.ndim;
+    dl.dtype              = dtype;
+    dl.shape              = ctx->fDims;
+    dl.strides            = ctx->fDims + PyBUF_MAX_NDIM;
+    dl.byte_offset        = 0;
+    for (int idim = 0; idim < layout.ndim; ++idim) {
+        if (layout.strides[idim] % layout.itemsize) {
+            delete ctx;
+            PyErr_SetString(PyExc_BufferError, "strides are not a multiple of the item size");
+            return nullptr;
+        }
+        dl.shape[idim]   = (int64_t)layout.shape[idim];
+        dl.strides[idim] = (int64_t)(layout.strides[idim] / layout.itemsize);
+    }
+
+// the consumer keeps the view, and thus the memory, alive
+    ctx->fOwner = (PyObject*)self;
+    Py_INCREF(self);
+    ctx->fTensor.manager_ctx = ctx;
+    ctx->fTensor.deleter     = ll_dlpack_deleter;
+
+    PyObject* capsule = PyCapsule_New(
+        &ctx->fTensor, DLPack::kCapsuleName, ll_dlpack_capsule_destructor);
+    if (!capsule)
+        ll_dlpack_deleter(&ctx->fTensor);
+    return capsule;
+}
+
+//---------------------------------------------------------------------------
+static PyObject* ll_dlpack_device(CPyCppyy::LowLevelView*)
+{
+    return Py_BuildValue((char*)"(ii)", (int)CPyCppyy::DLPack::kDLCPU, 0);
+}
+
 //---------------------------------------------------------------------------
 static PyMethodDef ll_methods[] = {
     {(char*)"reshape",     (PyCFunction)ll_reshape, METH_O,
@@ -902,6 +1862,26 @@ static PyMethodDef ll_methods[] = {
         (char*)"interpret memory as a null-terminated char string and return Python str"},
     {(char*)"__array__",   (PyCFunction)ll_array,   METH_VARARGS | METH_KEYWORDS,
         (char*)"return a numpy array from the low level view"},
+    {(char*)"sum",         (PyCFunction)ll_sum_m,   METH_NOARGS,
+        (char*)"return the sum of all items"},
+    {(char*)"min",         (PyCFunction)ll_min_m,   METH_NOARGS,
+        (char*)"return the smallest item"},
+    {(char*)"max",         (PyCFunction)ll_max_m,   METH_NOARGS,
+        (char*)"return the largest item"},
+    {(char*)"fill",        (PyCFunction)ll_fill_m,  METH_O,
+        (char*)"set all items to the given value"},
+    {(char*)"scale",       (PyCFunction)ll_scale_m, METH_O,
+        (char*)"multiply all items by the given factor"},
+    {(char*)"copy_from",   (PyCFunction)ll_copy_from, METH_O,
+        (char*)"copy all items from a buffer with the same item type and number of items"},
+    {(char*)"tolist",      (PyCFunction)ll_tolist,  METH_NOARGS,
+        (char*)"return the items as a (nested) list"},
+    {(char*)"tobytes",     (PyCFunction)ll_tobytes, METH_NOARGS,
+        (char*)"return a copy of the items, in C order, as bytes"},
+    {(char*)"__dlpack__",  (PyCFunction)ll_dlpack,  METH_VARARGS | METH_KEYWORDS,
+        (char*)"export the low level view as a DLPack capsule"},
+    {(char*)"__dlpack_device__", (PyCFunction)ll_dlpack_device, METH_NOARGS,
+        (char*)"return the DLPack device type and id of the memory"},
     {(char*)nullptr, nullptr, 0, nullptr}
 };
 
@@ -1056,6 +2036,22 @@ bool CPyCppyy::LowLevelView::resize(size_t sz)
     return false;
 }
 
+//---------------------------------------------------------------------------
+bool CPyCppyy::LowLevelView::restride(Py_ssize_t stride)
+{
+// Spread out the items of a 1-dim view, e.g. to expose a single data member of
+// all elements in an array of structs.
+    Py_buffer& bi = this->fBufInfo;
+    if (bi.ndim == 1 && bi.strides && bi.itemsize <= stride) {
+        bi.strides[0] = stride;
+        if (stride != bi.itemsize)
+            (intptr_t&)bi.internal |= kIsStrided;
+        return true;
+    }
+
+    return false;
+}
+
 //---------------------------------------------------------------------------
 template<typename T>
 static inline CPyCppyy::LowLevelView* CreateLowLevelViewT(
@@ -1124,19 +2120,14 @@ static inline CPyCppyy::LowLevelView* CreateLowLevelViewT(
 }
 
 //---------------------------------------------------------------------------
-#define CPPYY_RET_W_CREATOR(type, fname)                                    \
-    PyObject* (*c)(type, cdims_t) = &fname;                                 \
-    ll->fCreator = (LowLevelView::Creator_t)c;                              \
-    return (PyObject*)ll
-
 #define CPPYY_IMPL_VIEW_CREATOR(type)                                       \
 PyObject* CPyCppyy::CreateLowLevelView(type* address, cdims_t shape) {      \
     LowLevelView* ll = CreateLowLevelViewT<type>(address, shape);           \
-    CPPYY_RET_W_CREATOR(type*, CreateLowLevelView);                         \
+    return (PyObject*)ll;                                                   \
 }                                                                           \
 PyObject* CPyCppyy::CreateLowLevelView(type** address, cdims_t shape) {     \
     LowLevelView* ll = CreateLowLevelViewT<type>(address, shape);           \
-    CPPYY_RET_W_CREATOR(type**, CreateLowLevelView);                        \
+    return (PyObject*)ll;                                                   \
 }
 
 CPPYY_IMPL_VIEW_CREATOR(bool);
@@ -1163,40 +2154,54 @@ CPPYY_IMPL_VIEW_CREATOR(std::complex<long>);
 
 PyObject* CPyCppyy::CreateLowLevelView(char* address, cdims_t shape) {
     LowLevelView* ll = CreateLowLevelViewT<char>(address, shape);
-    CPPYY_RET_W_CREATOR(char*, CreateLowLevelView);
+    return (PyObject*)ll;
 }
 
 PyObject* CPyCppyy::CreateLowLevelView(char** address, cdims_t shape) {
     LowLevelView* ll = CreateLowLevelViewT<char>(address, shape);
-    CPPYY_RET_W_CREATOR(char**, CreateLowLevelView);
+    return (PyObject*)ll;
 }
 
 PyObject* CPyCppyy::CreateLowLevelViewString(char** address, cdims_t shape) {
     LowLevelView* ll = CreateLowLevelViewT<char*>(address, shape, nullptr, nullptr, sizeof(char));
-    CPPYY_RET_W_CREATOR(char**, CreateLowLevelViewString);
+    return (PyObject*)ll;
 }
 
 PyObject* CPyCppyy::CreateLowLevelViewString(const char** address, cdims_t shape) {
     LowLevelView* ll = CreateLowLevelViewT<const char*>(address, shape, nullptr, nullptr, sizeof(char));
-    CPPYY_RET_W_CREATOR(const char**, CreateLowLevelViewString);
+    return (PyObject*)ll;
+}
+
+PyObject* CPyCppyy::CreateLowLevelViewRecords(
+    void* address, Py_ssize_t nitems, Py_ssize_t itemsize, const char* format) {
+// items are not converted on indexing, only the buffer describes the records; an
+// empty array still needs a valid address for consumers of the buffer
+    static unsigned char sEmpty = 0;
+    LowLevelView* ll = CreateLowLevelViewT<unsigned char>(
+        address ? (unsigned char*)address : &sEmpty, {(dim_t)nitems}, format);
+    Py_buffer& view = ll->fBufInfo;
+    view.itemsize   = itemsize;
+    view.len        = nitems * itemsize;
+    view.strides[0] = itemsize;
+    return (PyObject*)ll;
 }
 
 PyObject* CPyCppyy::CreateLowLevelView_i8(int8_t* address,  cdims_t shape) {
     LowLevelView* ll = CreateLowLevelViewT<int8_t>(address, shape, "b", "int8_t");
-    CPPYY_RET_W_CREATOR(int8_t*, CreateLowLevelView_i8);
+    return (PyObject*)ll;
 }
 
 PyObject* CPyCppyy::CreateLowLevelView_i8(int8_t** address, cdims_t shape) {
     LowLevelView* ll = CreateLowLevelViewT<int8_t>(address, shape, "b", "int8_t");
-    CPPYY_RET_W_CREATOR(int8_t**, CreateLowLevelView_i8);
+    return (PyObject*)ll;
 }
 
 PyObject* CPyCppyy::CreateLowLevelView_i8(uint8_t* address,  cdims_t shape) {
     LowLevelView* ll = CreateLowLevelViewT<uint8_t>(address, shape, "B", "uint8_t");
-    CPPYY_RET_W_CREATOR(uint8_t*, CreateLowLevelView_i8);
+    return (PyObject*)ll;
 }
 
 PyObject* CPyCppyy::CreateLowLevelView_i8(uint8_t** address, cdims_t shape) {
     LowLevelView* ll = CreateLowLevelViewT<uint8_t>(address, shape, "B", "uint8_t");
-    CPPYY_RET_W_CREATOR(uint8_t**, CreateLowLevelView_i8);
+    return (PyObject*)ll;
 }
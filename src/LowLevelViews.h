@@ -22,7 +22,9 @@ public:
         kDefault     = 0x0000,
         kIsCppArray  = 0x0001,    // allocated with new[]
         kIsFixed     = 0x0002,    // fixed size array (assumed flat)
-        kIsOwner     = 0x0004 };  // Python owns
+        kIsOwner     = 0x0004,    // Python owns
+        kIsStrided   = 0x0008,    // items are not adjacent in memory
+        kIsSubView   = 0x0010 };  // shares memory and converters with fBufInfo.obj
 
 public:
     PyObject_HEAD
@@ -31,14 +33,12 @@ public:
     Converter*  fConverter;
     Converter*  fElemCnv;
 
-    typedef LowLevelView* (*Creator_t)(void*, cdims_t);
-    Creator_t   fCreator;    // for slicing, which requires copying
-
 public:
     void* get_buf() { return fBuf ? *fBuf : fBufInfo.buf; }
     void  set_buf(void** buf) { fBuf = buf; fBufInfo.buf = get_buf(); }
 
     bool resize(size_t sz);
+    bool restride(Py_ssize_t stride);
 };
 
 #define CPPYY_DECL_VIEW_CREATOR(type)                                        \
@@ -75,6 +75,10 @@ CPPYY_DECL_VIEW_CREATOR(std::complex<long>);
 PyObject* CreateLowLevelViewString(char**, cdims_t shape);
 PyObject* CreateLowLevelViewString(const char**, cdims_t shape);
 
+// array of plain structs described by a PEP 3118 format, for export only
+PyObject* CreateLowLevelViewRecords(
+    void* address, Py_ssize_t nitems, Py_ssize_t itemsize, const char* format);
+
 inline PyObject* CreatePointerView(void* ptr, cdims_t shape = 0) {
     return CreateLowLevelView((uintptr_t*)ptr, shape);
 }
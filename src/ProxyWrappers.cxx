@@ -15,6 +15,7 @@
 #include "MemoryRegulator.h"
 #include "PyStrings.h"
 #include "Pythonize.h"
+#include "ReflectionCache.h"
 #include "TemplateProxy.h"
 #include "TupleOfInstances.h"
 #include "TypeManip.h"
@@ -26,6 +27,7 @@
 #include <map>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 
@@ -33,12 +35,44 @@
 namespace CPyCppyy {
     extern PyObject* gThisModule;
     extern PyObject* gPyTypeMap;
-    extern std::set<Cppyy::TCppType_t> gPinnedTypes;
+    extern bool gLazyMethods;
 }
 
-// to prevent having to walk scopes, track python classes by C++ class
-typedef std::map<Cppyy::TCppScope_t, PyObject*> PyClassMap_t;
-static PyClassMap_t gPyClasses;
+// to prevent having to walk scopes, track python classes by C++ class; scope
+// handles are (in practice) small indices, so are looked up in a flat table,
+// with a hash map for any that are not
+namespace {
+
+struct PyClassEntry {
+    PyObject* fPyClass = nullptr;        // weak reference
+    bool      fPinned  = false;          // no down-casts on binding
+};
+
+const Cppyy::TCppScope_t kMaxTableScope = 1 << 20;
+std::vector<PyClassEntry> gPyClassTable;
+std::unordered_map<Cppyy::TCppScope_t, PyClassEntry> gPyClassMap;
+
+inline PyClassEntry* FindPyClassEntry(Cppyy::TCppScope_t scope)
+{
+    if (scope < gPyClassTable.size())
+        return &gPyClassTable[scope];
+    if (scope < kMaxTableScope)
+        return nullptr;
+    auto entry = gPyClassMap.find(scope);
+    return entry != gPyClassMap.end() ? &entry->second : nullptr;
+}
+
+PyClassEntry& GetPyClassEntry(Cppyy::TCppScope_t scope)
+{
+    if (scope < kMaxTableScope) {
+        if (gPyClassTable.size() <= scope)
+            gPyClassTable.resize(scope+1);
+        return gPyClassTable[scope];
+    }
+    return gPyClassMap[scope];
+}
+
+} // unnamed namespace
 
 
 //- helpers --------------------------------------------------------------------
@@ -93,6 +127,8 @@ void AddPropertyToClass(PyObject* pyclass,
     Cppyy::TCppScope_t scope, Cppyy::TCppIndex_t idata)
 {
     CPyCppyy::CPPDataMember* property = CPyCppyy::CPPDataMember_New(scope, idata);
+    if (CPPScope_Check(pyclass) && property->MayCache())
+        property->fCacheSlot = ((CPPScope*)pyclass)->fNDatamemberSlots++;
     PyObject* pname = CPyCppyy_PyText_InternFromString(const_cast<char*>(property->GetName().c_str()));
 
 // allow access at the instance level
@@ -152,21 +188,217 @@ static inline void sync_templates(
     Py_DECREF(pyname);
 }
 
+//----------------------------------------------------------------------------
+typedef std::vector<PyCallable*> Callables_t;
+typedef std::map<std::string, Callables_t> CallableCache_t;
+
+namespace {
+
+// state collected while adding methods to a class proxy
+struct ScopeMethods {
+    ScopeMethods(Cppyy::TCppScope_t scope, PyObject* pyclass, const unsigned int flags) :
+        fScope(scope), fPyClass(pyclass), fFlags(flags),
+        fIsNamespace(Cppyy::IsNamespace(scope)), fIsAbstract(Cppyy::IsAbstract(scope)),
+        fHasConstructor(false), fPotGetItem((Cppyy::TCppMethod_t)0) {}
+
+    Cppyy::TCppScope_t  fScope;
+    PyObject*           fPyClass;
+    unsigned int        fFlags;
+    bool                fIsNamespace;
+    bool                fIsAbstract;
+    bool                fHasConstructor;
+    Cppyy::TCppMethod_t fPotGetItem;
+    CallableCache_t     fCache;
+};
+
+} // unnamed namespace
+
+static void CollectMethod(ScopeMethods& sm, Cppyy::TCppIndex_t imeth, Cppyy::TCppMethod_t method,
+    const std::string& mtCppName, std::string mtName, bool isStubbedOperator)
+{
+// Create the callable for the given method and add it to the cache, or to its
+// template proxy on the class if it is (also) a template.
+    Cppyy::TCppScope_t scope = sm.fScope;
+    PyObject* pyclass = sm.fPyClass;
+
+// special case trackers
+    bool setupSetItem = false;
+    bool isConstructor = ReflectionCache::IsConstructor(method);
+    bool isTemplate = isConstructor ? false : ReflectionCache::IsMethodTemplate(scope, imeth);
+
+// operator[]/() returning a reference type will be used for __setitem__
+    bool isCall = mtName == "__call__";
+    if (isCall || mtName == "__getitem__") {
+        const std::string& qual_return = Cppyy::ResolveName(ReflectionCache::GetMethodResultType(method));
+        const std::string& cpd = TypeManip::compound(qual_return);
+        if (!cpd.empty() && cpd[cpd.size()-1] == '&' && \
+                qual_return.find("const", 0, 5) == std::string::npos) {
+            if (isCall && !sm.fPotGetItem) sm.fPotGetItem = method;
+            setupSetItem = true;     // will add methods as overloads
+        } else if (isCall && 1 < ReflectionCache::GetMethodNumArgs(method)) {
+        // not a non-const by-ref return, thus better __getitem__ candidate; the
+        // requirement for multiple arguments is that there is otherwise no benefit
+        // over the use of normal __getitem__ (this allows multi-indexing arguments,
+        // which is clean in Python, but not allowed in C++)
+            sm.fPotGetItem = method;
+        }
+    }
+
+// template members; handled by adding a dispatcher to the class
+    bool storeOnTemplate =
+        isTemplate ? true : (!isConstructor && ReflectionCache::ExistsMethodTemplate(scope, mtCppName));
+    if (storeOnTemplate) {
+        sync_templates(pyclass, mtCppName, mtName);
+    // continue processing to actually add the method so that the proxy can find
+    // it on the class when called explicitly
+    }
+
+// construct the holder
+    PyCallable* pycall = nullptr;
+    if (ReflectionCache::IsStaticMethod(method))  // class method
+        pycall = new CPPClassMethod(scope, method);
+    else if (sm.fIsNamespace)           // free function
+        pycall = new CPPFunction(scope, method);
+    else if (isConstructor) {           // ctor
+        mtName = "__init__";
+        sm.fHasConstructor = true;
+        if (!sm.fIsAbstract) {
+            if (sm.fFlags & CPPScope::kIsMultiCross) {
+                pycall = new CPPMultiConstructor(scope, method);
+            } else
+                pycall = new CPPConstructor(scope, method);
+        } else
+            pycall = new CPPAbstractClassConstructor(scope, method);
+    } else if (isStubbedOperator) {
+        pycall = new CPPOperator(scope, method, mtName);
+    } else                               // member function
+        pycall = new CPPMethod(scope, method);
+
+    if (storeOnTemplate) {
+    // template proxy was already created in sync_templates call above, so
+    // add only here, not to the cache of collected methods
+        PyObject* attr = PyObject_GetAttrString(pyclass, const_cast<char*>(mtName.c_str()));
+        if (isTemplate) ((TemplateProxy*)attr)->AdoptTemplate(pycall);
+        else ((TemplateProxy*)attr)->AdoptMethod(pycall);
+        Py_DECREF(attr);
+
+    // for operator[]/() that returns by ref, also add __setitem__
+        if (setupSetItem) {
+            TemplateProxy* pysi = (TemplateProxy*)GetAttrDirect(pyclass, PyStrings::gSetItem);
+            if (!TemplateProxy_Check(pysi)) {
+                 CPPOverload* precursor = (CPPOverload_Check(pysi)) ? (CPPOverload*)pysi : nullptr;
+                 if (pysi && !precursor) Py_DECREF(pysi);        // something unknown, just drop it
+                 pysi = TemplateProxy_New(mtCppName, "__setitem__", pyclass);
+                 if (precursor) pysi->MergeOverload(precursor);
+                 Py_XDECREF(precursor);
+                 PyObject_SetAttrString(pyclass, const_cast<char*>("__setitem__"), (PyObject*)pysi);
+            }
+            if (isTemplate) pysi->AdoptTemplate(new CPPSetItem(scope, method));
+            else pysi->AdoptMethod(new CPPSetItem(scope, method));
+            Py_XDECREF(pysi);
+        }
+
+    } else {
+    // lookup method dispatcher and store method
+        Callables_t& md = (*(sm.fCache.insert(
+            std::make_pair(mtName, Callables_t())).first)).second;
+        md.push_back(pycall);
+
+    // special case for operator[]/() that returns by ref, use for getitem/call and setitem
+        if (setupSetItem) {
+            Callables_t& setitem = (*(sm.fCache.insert(
+                std::make_pair(std::string("__setitem__"), Callables_t())).first)).second;
+            setitem.push_back(new CPPSetItem(scope, method));
+        }
+    }
+}
+
+//----------------------------------------------------------------------------
+static void AddCachedMethods(PyObject* pyclass, CallableCache_t& cache)
+{
+// Add the collected methods to the class dictionary.
+    PyObject* dct = PyObject_GetAttr(pyclass, PyStrings::gDict);
+    for (CallableCache_t::iterator imd = cache.begin(); imd != cache.end(); ++imd) {
+    // in order to prevent removing templated editions of this method (which were set earlier,
+    // above, as a different proxy object), we'll check and add this method flagged as a generic
+    // one (to be picked up by the templated one as appropriate) if a template exists
+        PyObject* pyname = CPyCppyy_PyText_FromString(const_cast<char*>(imd->first.c_str()));
+        PyObject* attr = PyObject_GetItem(dct, pyname);
+        Py_DECREF(pyname);
+        if (TemplateProxy_Check(attr)) {
+        // template exists, supply it with the non-templated method overloads
+            for (auto cit : imd->second)
+                ((TemplateProxy*)attr)->AdoptMethod(cit);
+        } else if (attr && !CPPOverload_Check(attr)) {
+        // set by a pythonization or the user (possibly before a deferred method was
+        // created), which takes precedence
+            for (auto cit : imd->second)
+                delete cit;
+        } else {
+            if (!attr) PyErr_Clear();
+        // normal case, add a new method
+            CPPOverload* method = CPPOverload_New(imd->first, imd->second);
+            PyObject* pymname = CPyCppyy_PyText_InternFromString(const_cast<char*>(method->GetName().c_str()));
+            PyType_Type.tp_setattro(pyclass, pymname, (PyObject*)method);
+            Py_DECREF(pymname);
+            Py_DECREF(method);
+        }
+
+        Py_XDECREF(attr);         // could have been found in base class or non-existent
+    }
+    Py_DECREF(dct);
+    cache.clear();
+}
+
+//----------------------------------------------------------------------------
+static inline bool HasLazyMethods(PyObject* pyclass)
+{
+    return pyclass != (PyObject*)&CPPInstance_Type && CPPScope_Check(pyclass) && \
+        ((CPPScope*)pyclass)->fLazyMethods;
+}
+
+static bool CanDeferMethod(PyObject* pyclass, const std::string& name, const LazyMethods_t& pending)
+{
+// Methods are created on first use only if their name is a plain identifier, as
+// specials fill type slots and template instances are managed by their template
+// proxy, and if they do not hide a base class method, as the normal lookup would
+// otherwise find the latter first.
+    if (pending.find(name) != pending.end())
+        return true;
+
+    if (name.empty() || name.find('<') != std::string::npos || \
+            (4 <= name.size() && name.compare(0, 2, "__") == 0 && name.compare(name.size()-2, 2, "__") == 0))
+        return false;
+
+    PyObject* pyname = CPyCppyy_PyText_FromString(name.c_str());
+    bool hides = (bool)_PyType_Lookup((PyTypeObject*)pyclass, pyname);
+    Py_DECREF(pyname);
+    if (hides)
+        return false;
+
+    PyObject* mro = ((PyTypeObject*)pyclass)->tp_mro;
+    for (Py_ssize_t ibase = 1; mro && ibase < PyTuple_GET_SIZE(mro); ++ibase) {
+        PyObject* pybase = PyTuple_GET_ITEM(mro, ibase);
+        if (HasLazyMethods(pybase) && ((CPPScope*)pybase)->fLazyMethods->count(name))
+            return false;
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------
 static int BuildScopeProxyDict(Cppyy::TCppScope_t scope, PyObject* pyclass, const unsigned int flags)
 {
 // Collect methods and data for the given scope, and add them to the given python
 // proxy object.
 
 // some properties that'll affect building the dictionary
-    bool isNamespace = Cppyy::IsNamespace(scope);
-    bool isAbstract  = Cppyy::IsAbstract(scope);
-    bool hasConstructor = false;
-    Cppyy::TCppMethod_t potGetItem = (Cppyy::TCppMethod_t)0;
+    ScopeMethods sm(scope, pyclass, flags);
+    bool isNamespace = sm.fIsNamespace;
+    bool isAbstract  = sm.fIsAbstract;
 
-// load all public methods and data members
-    typedef std::vector<PyCallable*> Callables_t;
-    typedef std::map<std::string, Callables_t> CallableCache_t;
-    CallableCache_t cache;
+// methods with plain names are recorded by index and created on first use
+    LazyMethods_t* pending = gLazyMethods && !isNamespace ? new LazyMethods_t : nullptr;
 
 // bypass custom __getattr__ for efficiency
     getattrofunc oldgetattro = Py_TYPE(pyclass)->tp_getattro;
@@ -174,21 +406,16 @@ static int BuildScopeProxyDict(Cppyy::TCppScope_t scope, PyObject* pyclass, cons
 
 // functions in namespaces are properly found through lazy lookup, so do not
 // create them until needed (the same is not true for data members)
-    const Cppyy::TCppIndex_t nMethods = isNamespace ? 0 : Cppyy::GetNumMethods(scope);
+    const Cppyy::TCppIndex_t nMethods = isNamespace ? 0 : ReflectionCache::GetNumMethods(scope);
     for (Cppyy::TCppIndex_t imeth = 0; imeth < nMethods; ++imeth) {
-        Cppyy::TCppMethod_t method = Cppyy::GetMethod(scope, imeth);
+        Cppyy::TCppMethod_t method = ReflectionCache::GetMethod(scope, imeth);
 
     // do not expose non-public methods as the Cling wrappers as those won't compile
-        if (!Cppyy::IsPublicMethod(method))
+        if (!ReflectionCache::IsPublicMethod(method))
             continue;
 
     // process the method based on its name
-        std::string mtCppName = Cppyy::GetMethodName(method);
-
-    // special case trackers
-        bool setupSetItem = false;
-        bool isConstructor = Cppyy::IsConstructor(method);
-        bool isTemplate = isConstructor ? false : Cppyy::IsMethodTemplate(scope, imeth);
+        std::string mtCppName = ReflectionCache::GetMethodName(method);
         bool isStubbedOperator = false;
 
     // filter empty names (happens for namespaces, is bug?)
@@ -201,95 +428,18 @@ static int BuildScopeProxyDict(Cppyy::TCppScope_t scope, PyObject* pyclass, cons
 
     // translate operators
         std::string mtName = Utility::MapOperatorName(
-            mtCppName, Cppyy::GetMethodNumArgs(method), &isStubbedOperator);
+            mtCppName, ReflectionCache::GetMethodNumArgs(method), &isStubbedOperator);
         if (mtName.empty())
             continue;
 
-    // operator[]/() returning a reference type will be used for __setitem__
-        bool isCall = mtName == "__call__";
-        if (isCall || mtName == "__getitem__") {
-            const std::string& qual_return = Cppyy::ResolveName(Cppyy::GetMethodResultType(method));
-            const std::string& cpd = TypeManip::compound(qual_return);
-            if (!cpd.empty() && cpd[cpd.size()-1] == '&' && \
-                    qual_return.find("const", 0, 5) == std::string::npos) {
-                if (isCall && !potGetItem) potGetItem = method;
-                setupSetItem = true;     // will add methods as overloads
-            } else if (isCall && 1 < Cppyy::GetMethodNumArgs(method)) {
-            // not a non-const by-ref return, thus better __getitem__ candidate; the
-            // requirement for multiple arguments is that there is otherwise no benefit
-            // over the use of normal __getitem__ (this allows multi-indexing arguments,
-            // which is clean in Python, but not allowed in C++)
-                potGetItem = method;
-            }
-        }
-
-    // template members; handled by adding a dispatcher to the class
-        bool storeOnTemplate =
-            isTemplate ? true : (!isConstructor && Cppyy::ExistsMethodTemplate(scope, mtCppName));
-        if (storeOnTemplate) {
-            sync_templates(pyclass, mtCppName, mtName);
-        // continue processing to actually add the method so that the proxy can find
-        // it on the class when called explicitly
+    // defer if possible, otherwise create the callable now
+        if (pending && mtName == mtCppName && !ReflectionCache::IsConstructor(method) && \
+                CanDeferMethod(pyclass, mtName, *pending)) {
+            (*pending)[mtName].push_back(imeth);
+            continue;
         }
 
-    // construct the holder
-        PyCallable* pycall = nullptr;
-        if (Cppyy::IsStaticMethod(method))  // class method
-            pycall = new CPPClassMethod(scope, method);
-        else if (isNamespace)               // free function
-            pycall = new CPPFunction(scope, method);
-        else if (isConstructor) {           // ctor
-            mtName = "__init__";
-            hasConstructor = true;
-            if (!isAbstract) {
-                if (flags & CPPScope::kIsMultiCross) {
-                    pycall = new CPPMultiConstructor(scope, method);
-                } else
-                    pycall = new CPPConstructor(scope, method);
-            } else
-                pycall = new CPPAbstractClassConstructor(scope, method);
-        } else if (isStubbedOperator) {
-            pycall = new CPPOperator(scope, method, mtName);
-        } else                               // member function
-            pycall = new CPPMethod(scope, method);
-
-        if (storeOnTemplate) {
-        // template proxy was already created in sync_templates call above, so
-        // add only here, not to the cache of collected methods
-            PyObject* attr = PyObject_GetAttrString(pyclass, const_cast<char*>(mtName.c_str()));
-            if (isTemplate) ((TemplateProxy*)attr)->AdoptTemplate(pycall);
-            else ((TemplateProxy*)attr)->AdoptMethod(pycall);
-            Py_DECREF(attr);
-
-        // for operator[]/() that returns by ref, also add __setitem__
-            if (setupSetItem) {
-                TemplateProxy* pysi = (TemplateProxy*)GetAttrDirect(pyclass, PyStrings::gSetItem);
-                if (!TemplateProxy_Check(pysi)) {
-                     CPPOverload* precursor = (CPPOverload_Check(pysi)) ? (CPPOverload*)pysi : nullptr;
-                     if (pysi && !precursor) Py_DECREF(pysi);        // something unknown, just drop it
-                     pysi = TemplateProxy_New(mtCppName, "__setitem__", pyclass);
-                     if (precursor) pysi->MergeOverload(precursor);
-                     Py_XDECREF(precursor);
-                     PyObject_SetAttrString(pyclass, const_cast<char*>("__setitem__"), (PyObject*)pysi);
-                }
-                if (isTemplate) pysi->AdoptTemplate(new CPPSetItem(scope, method));
-                else pysi->AdoptMethod(new CPPSetItem(scope, method));
-                Py_XDECREF(pysi);
-            }
-
-        } else {
-        // lookup method dispatcher and store method
-            Callables_t& md = (*(cache.insert(
-                std::make_pair(mtName, Callables_t())).first)).second;
-            md.push_back(pycall);
-
-        // special case for operator[]/() that returns by ref, use for getitem/call and setitem
-            if (setupSetItem) {
-                Callables_t& setitem = (*(cache.insert(
-                    std::make_pair(std::string("__setitem__"), Callables_t())).first)).second;
-                setitem.push_back(new CPPSetItem(scope, method));
-            }
-        }
+        CollectMethod(sm, imeth, method, mtCppName, mtName, isStubbedOperator);
     }
 
 // add proxies for un-instantiated/non-overloaded templated methods
@@ -314,7 +464,7 @@ static int BuildScopeProxyDict(Cppyy::TCppScope_t scope, PyObject* pyclass, cons
     }
 
 // add a pseudo-default ctor, if none defined
-    if (!hasConstructor) {
+    if (!sm.fHasConstructor) {
         PyCallable* defctor = nullptr;
         if (isAbstract)
             defctor = new CPPAbstractClassConstructor(scope, (Cppyy::TCppMethod_t)0);
@@ -325,52 +475,49 @@ static int BuildScopeProxyDict(Cppyy::TCppScope_t scope, PyObject* pyclass, cons
             defctor = new CPPIncompleteClassConstructor(scope, (Cppyy::TCppMethod_t)0);
         } else
             defctor = new CPPAllPrivateClassConstructor(scope, (Cppyy::TCppMethod_t)0);
-        cache["__init__"].push_back(defctor);
+        sm.fCache["__init__"].push_back(defctor);
     }
 
 // map __call__ to __getitem__ if also mapped to __setitem__
-    if (potGetItem) {
-        Callables_t& getitem = (*(cache.insert(
+    if (sm.fPotGetItem) {
+        Callables_t& getitem = (*(sm.fCache.insert(
            std::make_pair(std::string("__getitem__"), Callables_t())).first)).second;
-        getitem.push_back(new CPPGetItem(scope, potGetItem));
+        getitem.push_back(new CPPGetItem(scope, sm.fPotGetItem));
     }
 
 // add the methods to the class dictionary
-    PyObject* dct = PyObject_GetAttr(pyclass, PyStrings::gDict);
-    for (CallableCache_t::iterator imd = cache.begin(); imd != cache.end(); ++imd) {
-    // in order to prevent removing templated editions of this method (which were set earlier,
-    // above, as a different proxy object), we'll check and add this method flagged as a generic
-    // one (to be picked up by the templated one as appropriate) if a template exists
-        PyObject* pyname = CPyCppyy_PyText_FromString(const_cast<char*>(imd->first.c_str()));
-        PyObject* attr = PyObject_GetItem(dct, pyname);
-        Py_DECREF(pyname);
-        if (TemplateProxy_Check(attr)) {
-        // template exists, supply it with the non-templated method overloads
-            for (auto cit : imd->second)
-                ((TemplateProxy*)attr)->AdoptMethod(cit);
-        } else {
-            if (!attr) PyErr_Clear();
-        // normal case, add a new method
-            CPPOverload* method = CPPOverload_New(imd->first, imd->second);
-            PyObject* pymname = CPyCppyy_PyText_InternFromString(const_cast<char*>(method->GetName().c_str()));
-            PyType_Type.tp_setattro(pyclass, pymname, (PyObject*)method);
-            Py_DECREF(pymname);
-            Py_DECREF(method);
+    AddCachedMethods(pyclass, sm.fCache);
+
+// deferred methods that share their name with a template proxy need to be added
+// to it now, as lookups will find the proxy
+    if (pending && nTemplMethods) {
+        std::vector<std::string> templated;
+        PyObject* dct = ((PyTypeObject*)pyclass)->tp_dict;
+        for (const auto& lm : *pending) {
+            if (PyDict_GetItemString(dct, lm.first.c_str()))
+                templated.push_back(lm.first);
         }
+        ((CPPScope*)pyclass)->fLazyMethods = pending;
+        for (const auto& name : templated)
+            MaterializeMethod(pyclass, name, false);
+    }
 
-        Py_XDECREF(attr);         // could have been found in base class or non-existent
+    if (pending && !pending->empty())
+        ((CPPScope*)pyclass)->fLazyMethods = pending;
+    else {
+        ((CPPScope*)pyclass)->fLazyMethods = nullptr;
+        delete pending;
     }
-    Py_DECREF(dct);
 
  // collect data members (including enums)
-    const Cppyy::TCppIndex_t nDataMembers = Cppyy::GetNumDatamembers(scope);
+    const Cppyy::TCppIndex_t nDataMembers = ReflectionCache::GetNumDatamembers(scope);
     for (Cppyy::TCppIndex_t idata = 0; idata < nDataMembers; ++idata) {
     // allow only public members
-        if (!Cppyy::IsPublicData(scope, idata))
+        if (!ReflectionCache::IsPublicData(scope, idata))
             continue;
 
     // enum datamembers (this in conjunction with previously collected enums above)
-        if (Cppyy::IsEnumData(scope, idata) && Cppyy::IsStaticData(scope, idata)) {
+        if (ReflectionCache::IsEnumData(scope, idata) && ReflectionCache::IsStaticData(scope, idata)) {
         // some implementation-specific data members have no address: ignore them
             if (!Cppyy::GetDatamemberOffset(scope, idata))
                 continue;
@@ -378,7 +525,7 @@ static int BuildScopeProxyDict(Cppyy::TCppScope_t scope, PyObject* pyclass, cons
         // two options: this is a static variable, or it is the enum value, the latter
         // already exists, so check for it and move on if set
             PyObject* eset = PyObject_GetAttrString(pyclass,
-                const_cast<char*>(Cppyy::GetDatamemberName(scope, idata).c_str()));
+                const_cast<char*>(ReflectionCache::GetDatamemberName(scope, idata).c_str()));
             if (eset) {
                 Py_DECREF(eset);
                 continue;
@@ -388,8 +535,8 @@ static int BuildScopeProxyDict(Cppyy::TCppScope_t scope, PyObject* pyclass, cons
 
         // it could still be that this is an anonymous enum, which is not in the list
         // provided by the class
-            if (strstr(Cppyy::GetDatamemberType(scope, idata).c_str(), "(anonymous)") != 0 ||
-                strstr(Cppyy::GetDatamemberType(scope, idata).c_str(), "(unnamed)")   != 0) {
+            if (strstr(ReflectionCache::GetDatamemberType(scope, idata).c_str(), "(anonymous)") != 0 ||
+                strstr(ReflectionCache::GetDatamemberType(scope, idata).c_str(), "(unnamed)")   != 0) {
                 AddPropertyToClass(pyclass, scope, idata);
                 continue;
             }
@@ -493,20 +640,94 @@ static PyObject* BuildCppClassBases(Cppyy::TCppType_t klass)
 
 } // namespace CPyCppyy
 
+//----------------------------------------------------------------------------
+bool CPyCppyy::MaterializeMethod(PyObject* pyclass, const std::string& name, bool inherited)
+{
+// Create the methods of the given name that were recorded, but not created, when
+// the proxy of the given class (or, if inherited, of the first in its mro that has
+// them) was built. Returns true if any were added to the class dictionary.
+    PyObject* mro = inherited ? ((PyTypeObject*)pyclass)->tp_mro : nullptr;
+    Py_ssize_t nbases = mro ? PyTuple_GET_SIZE(mro) : 1;
+    for (Py_ssize_t ibase = 0; ibase < nbases; ++ibase) {
+        PyObject* pybase = mro ? PyTuple_GET_ITEM(mro, ibase) : pyclass;
+        if (!HasLazyMethods(pybase))
+            continue;
+
+        CPPScope* klass = (CPPScope*)pybase;
+        LazyMethods_t::iterator lm = klass->fLazyMethods->find(name);
+        if (lm == klass->fLazyMethods->end())
+            continue;
+
+    // remove the entry first, as creating the methods may cause lookups
+        std::vector<Cppyy::TCppIndex_t> indices;
+        indices.swap(lm->second);
+        klass->fLazyMethods->erase(lm);
+
+        getattrofunc oldgetattro = Py_TYPE(pybase)->tp_getattro;
+        Py_TYPE(pybase)->tp_getattro = PyType_Type.tp_getattro;
+
+        ScopeMethods sm(klass->fCppType, pybase, klass->fFlags);
+        for (auto imeth : indices)
+            CollectMethod(sm, imeth, ReflectionCache::GetMethod(klass->fCppType, imeth), name, name, false);
+        AddCachedMethods(pybase, sm.fCache);
+
+        Py_TYPE(pybase)->tp_getattro = oldgetattro;
+        return true;
+    }
+
+    return false;
+}
+
+//----------------------------------------------------------------------------
+void CPyCppyy::MaterializeMethods(PyObject* pyclass)
+{
+// Create all deferred methods of the given class and its bases. This is needed
+// once instances or Python derived classes exist, as lookups from those (e.g.
+// through super() or the method cache) go straight to the class dictionaries.
+    PyObject* mro = ((PyTypeObject*)pyclass)->tp_mro;
+    for (Py_ssize_t ibase = 0; mro && ibase < PyTuple_GET_SIZE(mro); ++ibase) {
+        PyObject* pybase = PyTuple_GET_ITEM(mro, ibase);
+        if (!HasLazyMethods(pybase))
+            continue;
+
+    // take the entries first, as creating the methods may cause lookups
+        CPPScope* klass = (CPPScope*)pybase;
+        LazyMethods_t* pending = klass->fLazyMethods;
+        klass->fLazyMethods = nullptr;
+
+        getattrofunc oldgetattro = Py_TYPE(pybase)->tp_getattro;
+        Py_TYPE(pybase)->tp_getattro = PyType_Type.tp_getattro;
+
+        ScopeMethods sm(klass->fCppType, pybase, klass->fFlags);
+        for (const auto& lm : *pending) {
+            for (auto imeth : lm.second)
+                CollectMethod(sm, imeth, ReflectionCache::GetMethod(klass->fCppType, imeth), lm.first, lm.first, false);
+        }
+        AddCachedMethods(pybase, sm.fCache);
+
+        Py_TYPE(pybase)->tp_getattro = oldgetattro;
+        delete pending;
+    }
+}
+
 //----------------------------------------------------------------------------
 PyObject* CPyCppyy::GetScopeProxy(Cppyy::TCppScope_t scope)
 {
 // Retrieve scope proxy from the known ones.
-    PyClassMap_t::iterator pci = gPyClasses.find(scope);
-    if (pci != gPyClasses.end()) {
-        PyObject* pyclass = CPyCppyy_GetWeakRef(pci->second);
-        if (pyclass)
-            return pyclass;
-    }
+    PyClassEntry* entry = FindPyClassEntry(scope);
+    if (entry && entry->fPyClass)
+        return CPyCppyy_GetWeakRef(entry->fPyClass);
 
     return nullptr;
 }
 
+//----------------------------------------------------------------------------
+void CPyCppyy::PinScope(Cppyy::TCppType_t klass)
+{
+// Objects of pinned classes are bound as such, without down-casting.
+    GetPyClassEntry(klass).fPinned = true;
+}
+
 //----------------------------------------------------------------------------
 PyObject* CPyCppyy::CreateScopeProxy(Cppyy::TCppScope_t scope, const unsigned flags)
 {
@@ -703,7 +924,9 @@ PyObject* CPyCppyy::CreateScopeProxy(const std::string& name, PyObject* parent,
 
     // store a ref from cppyy scope id to new python class
         if (pyscope && !(((CPPScope*)pyscope)->fFlags & CPPScope::kIsInComplete)) {
-            gPyClasses[klass] = PyWeakref_NewRef(pyscope, nullptr);
+            PyClassEntry& entry = GetPyClassEntry(klass);
+            Py_XDECREF(entry.fPyClass);
+            entry.fPyClass = PyWeakref_NewRef(pyscope, nullptr);
 
             if (!(((CPPScope*)pyscope)->fFlags & CPPScope::kIsNamespace)) {
             // add python-style features to classes only
@@ -927,7 +1150,8 @@ PyObject* CPyCppyy::BindCppObject(Cppyy::TCppObject_t address,
 // successful, no down-casting is attempted?
 // TODO: optimize for final classes
     unsigned new_flags = flags;
-    if (!isRef && (gPinnedTypes.empty() || gPinnedTypes.find(klass) == gPinnedTypes.end())) {
+    PyClassEntry* entry = isRef ? nullptr : FindPyClassEntry(klass);
+    if (!isRef && !(entry && entry->fPinned)) {
         Cppyy::TCppType_t clActual = Cppyy::GetActualClass(klass, address);
 
         if (clActual) {
@@ -17,6 +17,13 @@ PyObject* CreateScopeProxy(PyObject*, PyObject* args);
 PyObject* CreateScopeProxy(
     const std::string& scope_name, PyObject* parent = nullptr, const unsigned flags = 0);
 
+// bind objects of the given class as such, rather than as their actual class
+void PinScope(Cppyy::TCppType_t klass);
+
+// create class methods that were recorded, but deferred, when building the proxy
+bool MaterializeMethod(PyObject* pyclass, const std::string& name, bool inherited = true);
+void MaterializeMethods(PyObject* pyclass);
+
 // C++ exceptions form a special case b/c they have to derive from BaseException
 PyObject* CreateExcScopeProxy(PyObject* pyscope, PyObject* pyname, PyObject* parent);
 
@@ -75,6 +75,8 @@ PyObject* CPyCppyy::PyStrings::gPythonize        = nullptr;
 PyObject* CPyCppyy::PyStrings::gArray            = nullptr;
 PyObject* CPyCppyy::PyStrings::gDType            = nullptr;
 PyObject* CPyCppyy::PyStrings::gFromBuffer       = nullptr;
+PyObject* CPyCppyy::PyStrings::gAsArray          = nullptr;
+PyObject* CPyCppyy::PyStrings::gDLPack           = nullptr;
 
 
 //-----------------------------------------------------------------------------
@@ -161,6 +163,8 @@ bool CPyCppyy::CreatePyStrings() {
     CPPYY_INITIALIZE_STRING(gArray,          __array__);
     CPPYY_INITIALIZE_STRING(gDType,          dtype);
     CPPYY_INITIALIZE_STRING(gFromBuffer,     frombuffer);
+    CPPYY_INITIALIZE_STRING(gAsArray,        asarray);
+    CPPYY_INITIALIZE_STRING(gDLPack,         __dlpack__);
 
     return true;
 }
@@ -234,6 +238,8 @@ PyObject* CPyCppyy::DestroyPyStrings() {
     Py_DECREF(PyStrings::gArray);       PyStrings::gArray       = nullptr;
     Py_DECREF(PyStrings::gDType);       PyStrings::gDType       = nullptr;
     Py_DECREF(PyStrings::gFromBuffer);  PyStrings::gFromBuffer  = nullptr;
+    Py_DECREF(PyStrings::gAsArray);     PyStrings::gAsArray     = nullptr;
+    Py_DECREF(PyStrings::gDLPack);      PyStrings::gDLPack      = nullptr;
 
     Py_RETURN_NONE;
 }
@@ -78,6 +78,8 @@ namespace PyStrings {
     extern PyObject* gArray;
     extern PyObject* gDType;
     extern PyObject* gFromBuffer;
+    extern PyObject* gAsArray;
+    extern PyObject* gDLPack;
 
 } // namespace PyStrings
 
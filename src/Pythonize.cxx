@@ -1,11 +1,13 @@
 // Bindings
 #include "CPyCppyy.h"
 #include "Pythonize.h"
+#include "Arrow.h"
 #include "Converters.h"
 #include "CPPInstance.h"
 #include "CPPFunction.h"
 #include "CPPOverload.h"
 #include "CustomPyTypes.h"
+#include "DLPack.h"
 #include "LowLevelViews.h"
 #include "ProxyWrappers.h"
 #include "PyCallable.h"
@@ -38,6 +40,7 @@ using namespace CPyCppyy;
 bool HasAttrDirect(PyObject* pyclass, PyObject* pyname, bool mustBeCPyCppyy = false) {
 // prevents calls to Py_TYPE(pyclass)->tp_getattr, which is unnecessary for our
 // purposes here and could tickle problems w/ spurious lookups into ROOT meta
+    MaterializeMethod(pyclass, CPyCppyy_PyText_AsString(pyname), false);
     PyObject* dct = PyObject_GetAttr(pyclass, PyStrings::gDict);
     if (dct) {
         PyObject* attr = PyObject_GetItem(dct, pyname);
@@ -290,8 +293,9 @@ static ItemGetter* GetGetter(PyObject* args)
 
     // TODO: this only tests for new-style buffers, which is too strict, but a
     // generic check for Py_TYPE(fi)->tp_as_buffer is too loose (note that the
-    // main use case is numpy, which offers the new interface)
-        if (PyObject_CheckBuffer(fi))
+    // main use case is numpy, which offers the new interface); C++ strings and char
+    // vectors expose a buffer as well, but can not be passed to the constructor
+        if (PyObject_CheckBuffer(fi) && !CPPInstance_Check(fi))
             return nullptr;
 
         if (PyTuple_CheckExact(fi))
@@ -313,12 +317,93 @@ static ItemGetter* GetGetter(PyObject* args)
     return getter;
 }
 
+//- bulk conversions for std::vector<std::string> ------------------------------
+// The layout of std::string is shared with the C++ side, so vectors of strings
+// are filled and read directly, rather than through push_back and std::string
+// proxies for each item.
+static Cppyy::TCppType_t sVectorStringTypeID = (Cppyy::TCppType_t)0;
+
+static std::vector<std::string>* AsStringVector(PyObject* self)
+{
+    if (!sVectorStringTypeID)
+        sVectorStringTypeID = (Cppyy::TCppType_t)Cppyy::GetScope("std::vector<std::string>");
+    if (!sVectorStringTypeID || !CPPInstance_Check(self) ||
+            ((CPPClass*)Py_TYPE(self))->fCppType != sVectorStringTypeID)
+        return nullptr;
+    return (std::vector<std::string>*)((CPPInstance*)self)->GetObject();
+}
+
+static inline bool StringItem(PyObject* item, const char*& str, Py_ssize_t& len)
+{
+#if PY_VERSION_HEX >= 0x03000000
+    if (PyUnicode_Check(item))
+        return (bool)(str = PyUnicode_AsUTF8AndSize(item, &len));
+#endif
+    if (PyBytes_Check(item)) {
+        str = PyBytes_AS_STRING(item);
+        len = PyBytes_GET_SIZE(item);
+        return true;
+    }
+    return false;
+}
+
+static int FillStringVector(std::vector<std::string>* vec, PyObject* seq)
+{
+// Fill from a list or tuple of str/bytes; returns 0 if not applicable (leaving
+// the vector untouched), 1 on success, and -1 on error.
+    if (!PyList_CheckExact(seq) && !PyTuple_CheckExact(seq))
+        return 0;
+
+    Py_ssize_t sz = PySequence_Fast_GET_SIZE(seq);
+    PyObject** items = PySequence_Fast_ITEMS(seq);
+    for (Py_ssize_t i = 0; i < sz; ++i) {
+        if (!CPyCppyy_PyText_Check(items[i]) && !PyBytes_Check(items[i]))
+            return 0;
+    }
+
+    vec->reserve(vec->size() + (size_t)sz);
+    for (Py_ssize_t i = 0; i < sz; ++i) {
+        const char* str = nullptr; Py_ssize_t len = 0;
+        if (!StringItem(items[i], str, len))
+            return -1;          // encoding error
+        vec->emplace_back(str, (std::string::size_type)len);
+    }
+
+    return 1;
+}
+
+static PyObject* StringVectorToList(const std::vector<std::string>& vec)
+{
+    PyObject* result = PyList_New((Py_ssize_t)vec.size());
+    if (!result)
+        return nullptr;
+
+    for (std::vector<std::string>::size_type i = 0; i < vec.size(); ++i) {
+        PyObject* item = CPyCppyy_PyText_FromStringAndSize(vec[i].data(), (Py_ssize_t)vec[i].size());
+        if (!item) {
+            Py_DECREF(result);
+            return nullptr;
+        }
+        PyList_SET_ITEM(result, (Py_ssize_t)i, item);
+    }
+
+    return result;
+}
+
+//-----------------------------------------------------------------------------
 static bool FillVector(PyObject* vecin, PyObject* args, ItemGetter* getter)
 {
     Py_ssize_t sz = getter->size();
     if (sz < 0)
         return false;
 
+// strings in bulk, if possible
+    if (std::vector<std::string>* vec = AsStringVector(vecin)) {
+        int filled = FillStringVector(vec, PyTuple_GET_ITEM(args, 0));
+        if (filled)
+            return 0 < filled;
+    }
+
 // reserve memory as applicable
     if (0 < sz) {
         PyObject* res = PyObject_CallMethod(vecin, (char*)"reserve", (char*)"n", sz);
@@ -527,6 +612,50 @@ PyObject* VectorData(PyObject* self, PyObject*)
 PyObject* VectorArray(PyObject* self, PyObject* args, PyObject* kwargs)
 {
     PyObject* pydata = VectorData(self, nullptr);
+    if (!pydata)
+        return nullptr;
+
+    if (CPPInstance_Check(pydata)) {
+    // array of objects: export as a record array if the layout can be described
+        CPPInstance* pyobj = (CPPInstance*)pydata;
+        const char* fmt = ((CPPClass*)Py_TYPE(pydata))->GetRecordFormat();
+        Py_ssize_t nitems = pyobj->GetObject() ? pyobj->ArrayLength() : 0;   // empty vector
+        if (!fmt || nitems < 0) {
+            Py_DECREF(pydata);
+            PyErr_SetString(PyExc_TypeError, "elements can not be represented as a record");
+            return nullptr;
+        }
+
+        static PyObject* npmod = PyImport_ImportModule("numpy");    // ref-count kept
+        if (!npmod) {
+            Py_DECREF(pydata);
+            return nullptr;
+        }
+
+        PyObject* mview = CreateLowLevelViewRecords(pyobj->GetObject(), nitems,
+            Cppyy::SizeOf(((CPPClass*)Py_TYPE(pydata))->fCppType), fmt);
+        Py_DECREF(pydata);
+        if (!mview)
+            return nullptr;
+
+    // the view, which will be the base of the array, keeps the vector alive
+        Py_INCREF(self);
+        ((LowLevelView*)mview)->fBufInfo.obj = self;
+
+        PyObject* npasarray = PyObject_GetAttr(npmod, PyStrings::gAsArray);
+        PyObject* asargs = PyTuple_New(PyTuple_GET_SIZE(args)+1);
+        PyTuple_SET_ITEM(asargs, 0, mview);
+        for (Py_ssize_t i = 0; i < PyTuple_GET_SIZE(args); ++i) {
+            PyObject* item = PyTuple_GET_ITEM(args, i);
+            Py_INCREF(item);
+            PyTuple_SET_ITEM(asargs, i+1, item);
+        }
+        PyObject* newarr = PyObject_Call(npasarray, asargs, kwargs);
+        Py_DECREF(asargs);
+        Py_DECREF(npasarray);
+        return newarr;
+    }
+
     PyObject* arrcall = PyObject_GetAttr(pydata, PyStrings::gArray);
     PyObject* newarr = PyObject_Call(arrcall, args, kwargs);
     Py_DECREF(arrcall);
@@ -534,6 +663,126 @@ PyObject* VectorArray(PyObject* self, PyObject* args, PyObject* kwargs)
     return newarr;
 }
 
+//---------------------------------------------------------------------------
+PyObject* VectorToList(PyObject* self, PyObject*)
+{
+// bulk conversion through the view on the data, if any, iteration otherwise
+    if (std::vector<std::string>* vec = AsStringVector(self))
+        return StringVectorToList(*vec);
+
+    PyObject* pydata = VectorData(self, nullptr);
+    if (!pydata)
+        return nullptr;
+
+    if (LowLevelView_Check(pydata)) {
+        PyObject* result = CallPyObjMethod(pydata, "tolist");
+        Py_DECREF(pydata);
+        return result;
+    }
+
+    Py_DECREF(pydata);
+    return PySequence_List(self);
+}
+
+//---------------------------------------------------------------------------
+PyObject* VectorToBytes(PyObject* self, PyObject*)
+{
+    PyObject* pydata = VectorData(self, nullptr);
+    if (!pydata)
+        return nullptr;
+
+    PyObject* result = nullptr;
+    if (LowLevelView_Check(pydata))
+        result = CallPyObjMethod(pydata, "tobytes");
+    else if (CPPInstance_Check(pydata) && ((CPPClass*)Py_TYPE(pydata))->GetRecordFormat()) {
+    // plain structs have a well-defined memory representation
+        CPPInstance* pyobj = (CPPInstance*)pydata;
+        Py_ssize_t len = pyobj->ArrayLength();
+        if (0 <= len) {
+            result = PyBytes_FromStringAndSize((char*)pyobj->GetObject(),
+                len*Cppyy::SizeOf(((CPPClass*)Py_TYPE(pydata))->fCppType));
+        }
+    }
+
+    if (!result && !PyErr_Occurred())
+        PyErr_SetString(PyExc_TypeError, "elements have no byte representation");
+    Py_DECREF(pydata);
+    return result;
+}
+
+//---------------------------------------------------------------------------
+PyObject* VectorDLPack(PyObject* self, PyObject* args, PyObject* kwargs)
+{
+// export the contiguous data through the view, which keeps the container alive
+    PyObject* pydata = VectorData(self, nullptr);
+    if (!pydata)
+        return nullptr;
+
+    if (!LowLevelView_Check(pydata)) {
+        Py_DECREF(pydata);
+        PyErr_SetString(PyExc_BufferError, "elements can not be exported through DLPack");
+        return nullptr;
+    }
+
+    Py_buffer& bi = ((LowLevelView*)pydata)->fBufInfo;
+    if (!bi.obj) {
+        Py_INCREF(self);
+        bi.obj = self;
+    }
+
+    PyObject* dlcall = PyObject_GetAttr(pydata, PyStrings::gDLPack);
+    PyObject* capsule = dlcall ? PyObject_Call(dlcall, args, kwargs) : nullptr;
+    Py_XDECREF(dlcall);
+    Py_DECREF(pydata);
+    return capsule;
+}
+
+//---------------------------------------------------------------------------
+PyObject* VectorDLPackDevice(PyObject*, PyObject*)
+{
+    return Py_BuildValue("(ii)", (int)DLPack::kDLCPU, 0);
+}
+
+//---------------------------------------------------------------------------
+PyObject* VectorArrowArray(PyObject* self, PyObject* args, PyObject* kwargs)
+{
+// Arrow PyCapsule interface; a requested schema is only a hint, which is ignored
+    static const char* kwlist[] = {"requested_schema", nullptr};
+    PyObject* requested = nullptr;
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, const_cast<char*>("|O:__arrow_c_array__"),
+            const_cast<char**>(kwlist), &requested))
+        return nullptr;
+
+    PyObject* pyvtype = PyObject_GetAttr((PyObject*)Py_TYPE(self), PyStrings::gValueType);
+    if (!pyvtype)
+        return nullptr;
+    std::string vtype = CPyCppyy_PyText_AsString(pyvtype);
+    Py_DECREF(pyvtype);
+
+    PyObject* pydata = VectorData(self, nullptr);
+    if (!pydata)
+        return nullptr;
+
+    void* address = nullptr;
+    Py_ssize_t length = -1;
+    if (LowLevelView_Check(pydata)) {
+        Py_buffer& bi = ((LowLevelView*)pydata)->fBufInfo;
+        address = bi.buf;
+        length  = bi.ndim == 1 && bi.shape ? bi.shape[0] : -1;
+    } else if (CPPInstance_Check(pydata)) {
+        address = ((CPPInstance*)pydata)->GetObject();
+        length  = ((CPPInstance*)pydata)->ArrayLength();
+    }
+    Py_DECREF(pydata);
+
+    if (length < 0 || (length && !address)) {
+        PyErr_Format(PyExc_TypeError, "can not export data of type %s", vtype.c_str());
+        return nullptr;
+    }
+
+    return Arrow::ExportColumn(vtype, address, Cppyy::SizeOf(vtype), (int64_t)length, self);
+}
+
 
 //-----------------------------------------------------------------------------
 static PyObject* vector_iter(PyObject* v) {
@@ -740,6 +989,287 @@ PyObject* VectorBoolSetItem(CPPInstance* self, PyObject* args)
     Py_RETURN_NONE;
 }
 
+//- bulk conversions for std::vector<bool> -------------------------------------
+// Conversions between the packed bits and arrays of bools (one byte each, as in
+// numpy) or packed bytes (LSB first, as numpy.packbits with bitorder='little').
+// With libstdc++, the storage words are accessed directly, so that 8 bits are
+// handled at a time; otherwise, each bit goes through the reference proxy.
+static std::vector<bool>* AsBoolVector(PyObject* self)
+{
+    if (!CPPInstance_Check(self) || ((CPPInstance*)self)->ObjectIsA() != sVectorBoolTypeID) {
+        PyErr_SetString(PyExc_TypeError, "require object of type std::vector<bool>");
+        return nullptr;
+    }
+
+    std::vector<bool>* vb = (std::vector<bool>*)((CPPInstance*)self)->GetObject();
+    if (!vb)
+        PyErr_SetString(PyExc_ReferenceError, "attempt to access a null-pointer");
+    return vb;
+}
+
+#if defined(__GLIBCXX__)
+typedef std::_Bit_type vbword_t;
+static const size_t VB_WORDBYTES = sizeof(vbword_t);
+#endif
+
+static inline unsigned char PackByte(const unsigned char* bools)
+{
+// gather the low bits of 8 bytes (each 0 or 1) into a single byte
+    uint64_t x = 0;
+    for (int j = 0; j < 8; ++j)
+        x |= (uint64_t)bools[j] << (8*j);
+    return (unsigned char)((x * 0x0102040810204080ULL) >> 56);
+}
+
+static void UnpackBools(const std::vector<bool>& vb, unsigned char* out)
+{
+    const size_t n = vb.size();
+    size_t i = 0;
+#if defined(__GLIBCXX__)
+    static unsigned char sSpread[256][8];
+    static bool sInit = false;
+    if (!sInit) {
+        for (int b = 0; b < 256; ++b) {
+            for (int j = 0; j < 8; ++j)
+                sSpread[b][j] = (unsigned char)((b >> j) & 1);
+        }
+        sInit = true;
+    }
+
+    const vbword_t* words = vb.begin()._M_p;
+    for (size_t k = 0; k < n/8; ++k, i += 8) {
+        unsigned char b = (unsigned char)(words[k/VB_WORDBYTES] >> (8*(k%VB_WORDBYTES)));
+        memcpy(out+i, sSpread[b], 8);
+    }
+#endif
+    for (; i < n; ++i)
+        out[i] = (unsigned char)vb[i];
+}
+
+static void PackBools(std::vector<bool>& vb, const unsigned char* bools, size_t n)
+{
+    vb.clear();
+    vb.resize(n, false);
+    size_t i = 0;
+#if defined(__GLIBCXX__)
+    vbword_t* words = vb.begin()._M_p;
+    for (size_t k = 0; k < n/8; ++k, i += 8)
+        words[k/VB_WORDBYTES] |= (vbword_t)PackByte(bools+i) << (8*(k%VB_WORDBYTES));
+#endif
+    for (; i < n; ++i)
+        vb[i] = (bool)bools[i];
+}
+
+static void ToPackedBytes(const std::vector<bool>& vb, unsigned char* out)
+{
+    const size_t n = vb.size(), nbytes = (n+7)/8;
+#if defined(__GLIBCXX__)
+    const vbword_t* words = vb.begin()._M_p;
+    for (size_t k = 0; k < nbytes; ++k)
+        out[k] = (unsigned char)(words[k/VB_WORDBYTES] >> (8*(k%VB_WORDBYTES)));
+    if (n % 8)
+        out[nbytes-1] &= (unsigned char)((1 << (n%8)) - 1);
+#else
+    memset(out, 0, nbytes);
+    for (size_t i = 0; i < n; ++i)
+        out[i/8] |= (unsigned char)((int)vb[i] << (i%8));
+#endif
+}
+
+static void FromPackedBytes(std::vector<bool>& vb, const unsigned char* bytes, size_t n)
+{
+    vb.clear();
+    vb.resize(n, false);
+    size_t i = 0;
+#if defined(__GLIBCXX__)
+    vbword_t* words = vb.begin()._M_p;
+    for (size_t k = 0; k < n/8; ++k, i += 8)
+        words[k/VB_WORDBYTES] |= (vbword_t)bytes[k] << (8*(k%VB_WORDBYTES));
+#endif
+    for (; i < n; ++i)
+        vb[i] = (bytes[i/8] >> (i%8)) & 1;
+}
+
+static int FillBoolVector(std::vector<bool>& vb, PyObject* pyobject)
+{
+// Fill from a list or tuple of bools/ints, or a buffer of one-byte items; returns
+// 0 if not applicable, 1 on success, and -1 on error.
+    if (PyList_CheckExact(pyobject) || PyTuple_CheckExact(pyobject)) {
+        Py_ssize_t sz = PySequence_Fast_GET_SIZE(pyobject);
+        PyObject** items = PySequence_Fast_ITEMS(pyobject);
+        std::vector<unsigned char> bools((size_t)sz);
+        for (Py_ssize_t i = 0; i < sz; ++i) {
+            if (items[i] == Py_True || items[i] == Py_False)
+                bools[i] = items[i] == Py_True;
+            else if (PyLong_Check(items[i]))
+                bools[i] = PyObject_IsTrue(items[i]);
+            else
+                return 0;
+        }
+        PackBools(vb, bools.data(), bools.size());
+        return 1;
+    }
+
+    if (!PyObject_CheckBuffer(pyobject) || CPyCppyy_PyText_Check(pyobject) || PyBytes_Check(pyobject))
+        return 0;
+
+    Py_buffer view;
+    if (PyObject_GetBuffer(pyobject, &view, PyBUF_FORMAT | PyBUF_C_CONTIGUOUS) != 0) {
+        PyErr_Clear();
+        return 0;
+    }
+
+    int result = 0;
+    if (view.itemsize == 1 && view.format && strchr("?bBc", view.format[0]) && !view.format[1]) {
+        const unsigned char* data = (const unsigned char*)view.buf;
+        std::vector<unsigned char> normalized;
+        if (view.format[0] != '?') {
+        // numpy bools are 0 or 1, but other bytes need normalizing
+            normalized.resize((size_t)view.len);
+            for (Py_ssize_t i = 0; i < view.len; ++i)
+                normalized[i] = data[i] != 0;
+            data = normalized.data();
+        }
+        PackBools(vb, data, (size_t)view.len);
+        result = 1;
+    }
+
+    PyBuffer_Release(&view);
+    return result;
+}
+
+PyObject* VectorBoolInit(PyObject* self, PyObject* args, PyObject* /* kwds */)
+{
+// construct from lists of bools and arrays of bools in bulk
+    if (PyTuple_GET_SIZE(args) == 1) {
+        PyObject* arg = PyTuple_GET_ITEM(args, 0);
+        std::vector<bool> bits;
+        int filled = FillBoolVector(bits, arg);
+        if (filled < 0)
+            return nullptr;
+
+        if (filled) {
+        // construct an empty vector, then take over the bits
+            PyObject* result = PyObject_CallMethodNoArgs(self, PyStrings::gRealInit);
+            if (!result)
+                return nullptr;
+
+            std::vector<bool>* vb = AsBoolVector(self);
+            if (!vb) {
+                Py_DECREF(result);
+                return nullptr;
+            }
+            vb->swap(bits);
+            return result;
+        }
+    }
+
+    PyObject* realInit = PyObject_GetAttr(self, PyStrings::gRealInit);
+    if (realInit) {
+        PyObject* result = PyObject_Call(realInit, args, nullptr);
+        Py_DECREF(realInit);
+        return result;
+    }
+
+    return nullptr;
+}
+
+PyObject* VectorBoolToList(PyObject* self, PyObject*)
+{
+    std::vector<bool>* vb = AsBoolVector(self);
+    if (!vb)
+        return nullptr;
+
+    std::vector<unsigned char> bools(vb->size());
+    UnpackBools(*vb, bools.data());
+
+    PyObject* result = PyList_New((Py_ssize_t)bools.size());
+    if (!result)
+        return nullptr;
+    for (std::vector<unsigned char>::size_type i = 0; i < bools.size(); ++i) {
+        PyObject* item = bools[i] ? Py_True : Py_False;
+        Py_INCREF(item);
+        PyList_SET_ITEM(result, (Py_ssize_t)i, item);
+    }
+
+    return result;
+}
+
+PyObject* VectorBoolToBytes(PyObject* self, PyObject*)
+{
+    std::vector<bool>* vb = AsBoolVector(self);
+    if (!vb)
+        return nullptr;
+
+    PyObject* result = PyBytes_FromStringAndSize(nullptr, (Py_ssize_t)(vb->size()+7)/8);
+    if (result)
+        ToPackedBytes(*vb, (unsigned char*)PyBytes_AS_STRING(result));
+    return result;
+}
+
+PyObject* VectorBoolFromBytes(PyObject* self, PyObject* args)
+{
+// replace the contents with the given packed bits; size defaults to all bits
+    PyObject* pydata = nullptr; Py_ssize_t size = -1;
+    if (!PyArg_ParseTuple(args, const_cast<char*>("O|n:frombytes"), &pydata, &size))
+        return nullptr;
+
+    std::vector<bool>* vb = AsBoolVector(self);
+    if (!vb)
+        return nullptr;
+
+    Py_buffer view;
+    if (PyObject_GetBuffer(pydata, &view, PyBUF_SIMPLE) != 0)
+        return nullptr;
+
+    if (size < 0)
+        size = 8*view.len;
+    else if (8*view.len < size) {
+        PyBuffer_Release(&view);
+        PyErr_Format(PyExc_ValueError, "%zd bits requested, but only %zd available", size, 8*view.len);
+        return nullptr;
+    }
+
+    FromPackedBytes(*vb, (const unsigned char*)view.buf, (size_t)size);
+    PyBuffer_Release(&view);
+    Py_RETURN_NONE;
+}
+
+PyObject* VectorBoolArray(PyObject* self, PyObject* args, PyObject* kwargs)
+{
+// unpack into a (writable, but detached) numpy array of bools
+    std::vector<bool>* vb = AsBoolVector(self);
+    if (!vb)
+        return nullptr;
+
+    static PyObject* npmod = PyImport_ImportModule("numpy");    // ref-count kept
+    if (!npmod)
+        return nullptr;
+
+    PyObject* bools = PyByteArray_FromStringAndSize(nullptr, (Py_ssize_t)vb->size());
+    if (!bools)
+        return nullptr;
+    UnpackBools(*vb, (unsigned char*)PyByteArray_AS_STRING(bools));
+
+    PyObject* arr = PyObject_CallMethod(npmod, (char*)"frombuffer", (char*)"Os", bools, "?");
+    Py_DECREF(bools);
+    if (!arr || (!PyTuple_GET_SIZE(args) && !kwargs))
+        return arr;
+
+    PyObject* npasarray = PyObject_GetAttr(npmod, PyStrings::gAsArray);
+    PyObject* asargs = PyTuple_New(PyTuple_GET_SIZE(args)+1);
+    PyTuple_SET_ITEM(asargs, 0, arr);
+    for (Py_ssize_t i = 0; i < PyTuple_GET_SIZE(args); ++i) {
+        PyObject* item = PyTuple_GET_ITEM(args, i);
+        Py_INCREF(item);
+        PyTuple_SET_ITEM(asargs, i+1, item);
+    }
+    PyObject* newarr = PyObject_Call(npasarray, asargs, kwargs);
+    Py_DECREF(asargs);
+    Py_DECREF(npasarray);
+    return newarr;
+}
+
 
 //- array behavior as primitives ----------------------------------------------
 PyObject* ArrayInit(PyObject* self, PyObject* args, PyObject* /* kwds */)
@@ -829,11 +1359,254 @@ static PyObject* MapFromPairs(PyObject* self, PyObject* pairs)
     return result;
 }
 
+//- bulk conversions for maps of builtins and strings -------------------------
+// Maps of which both key and mapped type are builtins or std::string are filled
+// from, and walked into, contiguous arrays by JIT-ed loops, with the conversions
+// done natively through the converters, instead of through __setitem__ and the
+// iterator protocol (which create temporaries and pair proxies for each item).
+struct MapBulkType {
+    std::string fName;
+    size_t      fSize;
+    bool        fIsString;
+    Converter*  fConverter;
+
+    bool init(const std::string& name) {
+        fName = name;
+        fIsString = name == "std::string";
+        fSize = fIsString ? sizeof(std::string) : Cppyy::SizeOf(name);
+        if (!fSize || !(fIsString || (Cppyy::IsBuiltin(name) && TypeManip::compound(name).empty())))
+            return false;
+        fConverter = CreateConverter(name);
+        return (bool)fConverter;
+    }
+
+    PyObject* box(const void* address) const {
+        if (fIsString) {
+            const std::string& s = *(const std::string*)address;
+            return CPyCppyy_PyText_FromStringAndSize(s.data(), (Py_ssize_t)s.size());
+        }
+        return fConverter->FromMemory((void*)address);
+    }
+};
+
+class MapBulkStore {
+public:
+    MapBulkStore(const MapBulkType& t, size_t n) : fType(t) {
+        if (t.fIsString) fStrings.resize(n);
+        else fRaw.resize(n ? n*t.fSize : 1);
+    }
+
+    void* data() { return fType.fIsString ? (void*)fStrings.data() : (void*)fRaw.data(); }
+    void* at(size_t i) { return (char*)data() + i*fType.fSize; }
+
+private:
+    const MapBulkType&       fType;
+    std::vector<std::string> fStrings;
+    std::vector<char>        fRaw;
+};
+
+struct MapBulkOps {
+    typedef void   (*fill_t)(void* map, void* keys, void* values, size_t n);
+    typedef size_t (*walk_t)(void* map, const void** keys, const void** values);
+    typedef const void* (*find_t)(void* map, const void* key);
+
+    MapBulkType fKey, fValue;
+    fill_t      fFill;
+    walk_t      fWalk;
+    find_t      fFind;
+};
+
+static MapBulkOps* GetMapBulkOps(PyObject* self)
+{
+// Lookup, or create on first use, the bulk operations for the class of self;
+// returns null if the map does not qualify.
+    static std::map<Cppyy::TCppType_t, MapBulkOps*> sOps;
+    static int sCount = 0;
+
+    if (!CPPInstance_Check(self))
+        return nullptr;
+
+    Cppyy::TCppType_t klass = ((CPPClass*)Py_TYPE(self))->fCppType;
+    auto iops = sOps.find(klass);
+    if (iops != sOps.end())
+        return iops->second;
+
+    MapBulkOps* ops = new MapBulkOps{};
+    sOps[klass] = nullptr;
+
+    const std::string& name = Cppyy::GetScopedFinalName(klass);
+    if (!ops->fKey.init(Cppyy::ResolveName(name+"::key_type")) ||
+            !ops->fValue.init(Cppyy::ResolveName(name+"::mapped_type"))) {
+        delete ops;
+        return nullptr;
+    }
+
+    std::ostringstream code;
+    const std::string& id = std::to_string(++sCount);
+    code << "namespace __cppyy_internal {\n"
+            "void map_fill_" << id << "(void* m, void* k, void* v, size_t n) {\n"
+            "  auto& mm = *(" << name << "*)m;\n";
+    if (IsTemplatedSTLClass(name, "unordered_map"))
+        code << "  mm.reserve(mm.size()+n);\n";
+    code << "  for (size_t i = 0; i < n; ++i)\n"
+            "    mm[((" << ops->fKey.fName << "*)k)[i]] = ((" << ops->fValue.fName << "*)v)[i];\n"
+            "}\n"
+            "size_t map_walk_" << id << "(void* m, const void** k, const void** v) {\n"
+            "  size_t i = 0;\n"
+            "  for (const auto& p : *(" << name << "*)m) { k[i] = &p.first; v[i] = &p.second; ++i; }\n"
+            "  return i;\n"
+            "}\n"
+            "const void* map_find_" << id << "(void* m, const void* k) {\n"
+            "  const auto& mm = *(const " << name << "*)m;\n"
+            "  auto it = mm.find(*(const " << ops->fKey.fName << "*)k);\n"
+            "  return it != mm.end() ? (const void*)&it->second : nullptr;\n"
+            "} }";
+
+    if (!Utility::Compile(code.str(), true /* silent */)) {
+        delete ops;
+        return nullptr;
+    }
+
+    Cppyy::TCppScope_t scope = Cppyy::GetScope("__cppyy_internal");
+    const auto& fidx = Cppyy::GetMethodIndicesFromName(scope, "map_fill_"+id);
+    const auto& widx = Cppyy::GetMethodIndicesFromName(scope, "map_walk_"+id);
+    const auto& xidx = Cppyy::GetMethodIndicesFromName(scope, "map_find_"+id);
+    if (fidx.empty() || widx.empty() || xidx.empty()) {
+        delete ops;
+        return nullptr;
+    }
+
+    ops->fFill = (MapBulkOps::fill_t)Cppyy::GetFunctionAddress(Cppyy::GetMethod(scope, fidx[0]), false);
+    ops->fWalk = (MapBulkOps::walk_t)Cppyy::GetFunctionAddress(Cppyy::GetMethod(scope, widx[0]), false);
+    ops->fFind = (MapBulkOps::find_t)Cppyy::GetFunctionAddress(Cppyy::GetMethod(scope, xidx[0]), false);
+    if (!ops->fFill || !ops->fWalk || !ops->fFind) {
+        delete ops;
+        return nullptr;
+    }
+
+    sOps[klass] = ops;
+    return ops;
+}
+
+static PyObject* MapFromDict(PyObject* self, PyObject* dct, MapBulkOps* ops)
+{
+// construct an empty map, then fill it with all converted items in one go
+    Py_ssize_t n = PyDict_Size(dct);
+    MapBulkStore keys(ops->fKey, (size_t)n), values(ops->fValue, (size_t)n);
+
+    PyObject *key, *value;
+    Py_ssize_t pos = 0, i = 0;
+    while (PyDict_Next(dct, &pos, &key, &value)) {
+        if (!ops->fKey.fConverter->ToMemory(key, keys.at(i)) ||
+                !ops->fValue.fConverter->ToMemory(value, values.at(i))) {
+            if (!PyErr_Occurred())
+                PyErr_SetString(PyExc_TypeError, "Failed to fill map (incompatible key or value)");
+            return nullptr;
+        }
+        i += 1;
+    }
+
+    PyObject* result = PyObject_CallMethodNoArgs(self, PyStrings::gRealInit);
+    if (!result)
+        return nullptr;
+
+    void* cppmap = ((CPPInstance*)self)->GetObject();
+    if (!cppmap) {
+        Py_DECREF(result);
+        PyErr_SetString(PyExc_ReferenceError, "attempt to access a null-pointer");
+        return nullptr;
+    }
+
+    ops->fFill(cppmap, keys.data(), values.data(), (size_t)i);
+    return result;
+}
+
+PyObject* MapToDict(PyObject* self, PyObject*)
+{
+// Build a dict from all items; strings are returned as str.
+    PyObject* dct = PyDict_New();
+    if (!dct)
+        return nullptr;
+
+    MapBulkOps* ops = GetMapBulkOps(self);
+    void* cppmap = ops ? ((CPPInstance*)self)->GetObject() : nullptr;
+    if (!cppmap) {
+    // generic case: iterate, with pairs unpacking as sequences
+        if (PyDict_MergeFromSeq2(dct, self, 1) < 0) {
+            Py_DECREF(dct);
+            return nullptr;
+        }
+        return dct;
+    }
+
+    PyObject* pysize = PyObject_CallMethodNoArgs(self, PyStrings::gSize);
+    if (!pysize) {
+        Py_DECREF(dct);
+        return nullptr;
+    }
+    size_t n = (size_t)PyLong_AsSize_t(pysize);
+    Py_DECREF(pysize);
+    if (n == (size_t)-1 && PyErr_Occurred()) {
+        Py_DECREF(dct);
+        return nullptr;
+    }
+
+    std::vector<const void*> keys(n+1), values(n+1);
+    n = ops->fWalk(cppmap, keys.data(), values.data());
+    for (size_t i = 0; i < n; ++i) {
+        PyObject* pykey = ops->fKey.box(keys[i]);
+        PyObject* pyvalue = pykey ? ops->fValue.box(values[i]) : nullptr;
+        int err = pyvalue ? PyDict_SetItem(dct, pykey, pyvalue) : -1;
+        Py_XDECREF(pyvalue);
+        Py_XDECREF(pykey);
+        if (err) {
+            Py_DECREF(dct);
+            return nullptr;
+        }
+    }
+
+    return dct;
+}
+
+PyObject* MapGetItem(PyObject* self, PyObject* pykey)
+{
+// Look up existing keys with find(), which is what dict(m) does for each key that
+// keys() returns; anything else (including std::string values, which operator[]
+// returns by reference, and missing keys, which it inserts) goes to operator[].
+    MapBulkOps* ops = GetMapBulkOps(self);
+    void* cppmap = ops && !ops->fValue.fIsString ? ((CPPInstance*)self)->GetObject() : nullptr;
+    if (cppmap) {
+        MapBulkStore key(ops->fKey, 1);
+        if (ops->fKey.fConverter->ToMemory(pykey, key.at(0))) {
+            if (const void* value = ops->fFind(cppmap, key.at(0)))
+                return ops->fValue.box(value);
+        } else
+            PyErr_Clear();
+    }
+
+    PyObject* getitem = PyObject_GetAttr(self, PyStrings::gGetNoCheck);
+    if (!getitem) {
+        PyErr_Clear();
+        PyErr_SetObject(PyExc_KeyError, pykey);
+        return nullptr;
+    }
+
+    PyObject* result = PyObject_CallFunctionObjArgs(getitem, pykey, nullptr);
+    Py_DECREF(getitem);
+    return result;
+}
+
 PyObject* MapInit(PyObject* self, PyObject* args, PyObject* /* kwds */)
 {
 // Specialized map constructor to allow construction from mapping containers and
 // from tuples of pairs ("initializer_list style").
 
+// dicts of builtins and strings are converted in bulk
+    if (PyTuple_GET_SIZE(args) == 1 && PyDict_Check(PyTuple_GET_ITEM(args, 0))) {
+        if (MapBulkOps* ops = GetMapBulkOps(self))
+            return MapFromDict(self, PyTuple_GET_ITEM(args, 0), ops);
+    }
+
 // PyMapping_Check is not very discriminatory, as it basically only checks for the
 // existence of  __getitem__, hence the most common cases of tuple and list are
 // dropped straight-of-the-bat (the PyMapping_Items call will fail on them).
@@ -847,6 +1620,12 @@ PyObject* MapInit(PyObject* self, PyObject* args, PyObject* /* kwds */)
     // in p3, PyMapping_Items isn't a macro, but a function that short-circuits dict
         PyObject* items = PyMapping_Items(assoc);
 #endif
+    // items() of C++ maps is an iterator, which needs collecting first
+        if (items && !PySequence_Check(items)) {
+            PyObject* litems = PySequence_List(items);
+            Py_DECREF(items);
+            items = litems;
+        }
         if (items && PySequence_Check(items)) {
             PyObject* result = MapFromPairs(self, items);
             Py_DECREF(items);
@@ -982,9 +1761,176 @@ PyObject* LLSequenceIter(PyObject* self)
     return nullptr;
 }
 
+static bool InitSTLIterBox(stliterbox& box, const std::string& type, ptrdiff_t offset, bool asstr)
+{
+// elements are boxed as objects (by reference) if a class, or through a converter;
+// strings are optionally returned as str
+    const std::string& resolved = Cppyy::ResolveName(TypeManip::remove_const(type));
+    box.sb_offset   = offset;
+    box.sb_isstring = asstr && resolved == "std::string";
+    box.sb_klass    = TypeManip::compound(resolved).empty() ? \
+        (Cppyy::TCppType_t)Cppyy::GetScope(resolved) : (Cppyy::TCppType_t)0;
+    box.sb_converter = box.sb_klass ? nullptr : CreateConverter(resolved);
+    return box.sb_klass || box.sb_converter;
+}
+
+static const stliterthunks* GetSTLIterThunks(PyObject* self)
+{
+// Lookup, or JIT on first use, the iteration thunks for the class of self; only
+// STL containers are considered, and null is returned if the container does not
+// qualify (e.g. if dereferencing its iterators does not produce an lvalue).
+    static std::map<Cppyy::TCppType_t, stliterthunks*> sThunks;
+    static int sCount = 0;
+
+    Cppyy::TCppType_t klass = ((CPPClass*)Py_TYPE(self))->fCppType;
+    auto ith = sThunks.find(klass);
+    if (ith != sThunks.end())
+        return ith->second;
+    sThunks[klass] = nullptr;
+
+    const std::string& name = Cppyy::GetScopedFinalName(klass);
+    if (name.rfind("std::", 0) != 0)
+        return nullptr;
+
+    const std::string& id = std::to_string(++sCount);
+    const std::string state = "stliter_state_" + id;
+    std::ostringstream code;
+    code << "#include <memory>\n"
+            "namespace __cppyy_internal {\n"
+            "struct " << state << " { decltype(std::declval<" << name << "&>().begin()) fIt, fEnd; };\n"
+            "void* stliter_begin_" << id << "(void* c) {\n"
+            "  auto& cc = *(" << name << "*)c;\n"
+            "  return new " << state << "{cc.begin(), cc.end()};\n"
+            "}\n"
+            "void* stliter_next_" << id << "(void* s) {\n"
+            "  auto* st = (" << state << "*)s;\n"
+            "  if (st->fIt == st->fEnd) return nullptr;\n"
+            "  void* addr = (void*)std::addressof(*st->fIt);\n"
+            "  ++st->fIt;\n"
+            "  return addr;\n"
+            "}\n"
+            "void stliter_free_" << id << "(void* s) { delete (" << state << "*)s; }\n"
+            "}";
+
+    if (!Utility::Compile(code.str(), true /* silent */))
+        return nullptr;
+
+    Cppyy::TCppScope_t scope = Cppyy::GetScope("__cppyy_internal");
+    void* addrs[3] = {nullptr, nullptr, nullptr};
+    const char* fnames[3] = {"stliter_begin_", "stliter_next_", "stliter_free_"};
+    for (int i = 0; i < 3; ++i) {
+        const auto& idx = Cppyy::GetMethodIndicesFromName(scope, fnames[i]+id);
+        if (idx.empty())
+            return nullptr;
+        addrs[i] = (void*)Cppyy::GetFunctionAddress(Cppyy::GetMethod(scope, idx[0]), false);
+        if (!addrs[i])
+            return nullptr;
+    }
+
+    stliterthunks* thunks = new stliterthunks{};
+    thunks->st_begin = (void* (*)(void*))addrs[0];
+    thunks->st_next  = (void* (*)(void*))addrs[1];
+    thunks->st_free  = (void  (*)(void*))addrs[2];
+
+    const std::string& value_type = Cppyy::ResolveName(name+"::value_type");
+    if (!InitSTLIterBox(thunks->st_elem, value_type, 0, false)) {
+        delete thunks;
+        return nullptr;
+    }
+
+// pairs (e.g. of maps) can also be iterated over as items, keys, and values, by
+// reading their members directly at the known offsets
+    Cppyy::TCppScope_t pklass = thunks->st_elem.sb_klass;
+    if (pklass && value_type.rfind("std::pair<", 0) == 0) {
+        Cppyy::TCppIndex_t ifirst  = Cppyy::GetDatamemberIndex(pklass, "first");
+        Cppyy::TCppIndex_t isecond = Cppyy::GetDatamemberIndex(pklass, "second");
+        thunks->st_ispair = ifirst != (Cppyy::TCppIndex_t)-1 && isecond != (Cppyy::TCppIndex_t)-1 &&
+            InitSTLIterBox(thunks->st_key, Cppyy::GetDatamemberType(pklass, ifirst),
+                Cppyy::GetDatamemberOffset(pklass, ifirst), true) &&
+            InitSTLIterBox(thunks->st_value, Cppyy::GetDatamemberType(pklass, isecond),
+                Cppyy::GetDatamemberOffset(pklass, isecond), true);
+    }
+
+    sThunks[klass] = thunks;
+    return thunks;
+}
+
+static PyObject* MapIterMode(PyObject* self, int mode)
+{
+// Iterate over the pairs of a map as items, keys, or values, natively if possible;
+// otherwise, collect them by unpacking the pairs.
+    if (CPPInstance_Check(self)) {
+        const stliterthunks* thunks = GetSTLIterThunks(self);
+        void* cppself = ((CPPInstance*)self)->GetObject();
+        if (thunks && thunks->st_ispair && cppself)
+            return STLIter_New(self, cppself, thunks, mode);
+    }
+
+    PyObject* iter = PyObject_GetIter(self);
+    if (!iter)
+        return nullptr;
+
+    PyObject* result = PyList_New(0);
+    while (PyObject* pair = PyIter_Next(iter)) {
+        PyObject* entry = nullptr;
+        if (mode == stliterobject::kKeys)
+            entry = PySequence_GetItem(pair, 0);
+        else if (mode == stliterobject::kValues)
+            entry = PySequence_GetItem(pair, 1);
+        else {
+            PyObject* key = PySequence_GetItem(pair, 0);
+            PyObject* value = key ? PySequence_GetItem(pair, 1) : nullptr;
+            if (value) entry = PyTuple_Pack(2, key, value);
+            Py_XDECREF(value);
+            Py_XDECREF(key);
+        }
+        Py_DECREF(pair);
+        if (!entry || PyList_Append(result, entry) != 0) {
+            Py_XDECREF(entry);
+            Py_DECREF(result);
+            Py_DECREF(iter);
+            return nullptr;
+        }
+        Py_DECREF(entry);
+    }
+    Py_DECREF(iter);
+
+    if (PyErr_Occurred()) {
+        Py_DECREF(result);
+        return nullptr;
+    }
+
+    PyObject* listiter = PyObject_GetIter(result);
+    Py_DECREF(result);
+    return listiter;
+}
+
+PyObject* MapItems(PyObject* self, PyObject*)
+{
+    return MapIterMode(self, stliterobject::kItems);
+}
+
+PyObject* MapKeys(PyObject* self, PyObject*)
+{
+    return MapIterMode(self, stliterobject::kKeys);
+}
+
+PyObject* MapValues(PyObject* self, PyObject*)
+{
+    return MapIterMode(self, stliterobject::kValues);
+}
+
 PyObject* STLSequenceIter(PyObject* self)
 {
 // Implement python's __iter__ for std::iterator<>s
+    if (CPPInstance_Check(self)) {
+        if (const stliterthunks* thunks = GetSTLIterThunks(self)) {
+            void* cppself = ((CPPInstance*)self)->GetObject();
+            if (cppself)
+                return STLIter_New(self, cppself, thunks);
+        }
+    }
+
     PyObject* iter = PyObject_CallMethodNoArgs(self, PyStrings::gBegin);
     if (iter) {
         PyObject* end = PyObject_CallMethodNoArgs(self, PyStrings::gEnd);
@@ -1368,6 +2314,57 @@ Py_hash_t STLStringHash(PyObject* self)
 }
 
 
+//- buffer protocol over contiguous character storage ---------------------------
+// std::string, std::string_view, and vectors of chars export their storage
+// directly (as unsigned bytes, like bytes objects), so that consumers of the
+// buffer protocol do not need a copy. As with views, the exported memory is
+// invalidated if the C++ object is resized or destroyed.
+#if PY_VERSION_HEX >= 0x03000000
+template<typename T>
+static T* BufferTarget(PyObject* self, Py_buffer* view)
+{
+    T* obj = CPPInstance_Check(self) ? (T*)((CPPInstance*)self)->GetObject() : nullptr;
+    if (!obj) {
+        PyErr_SetString(PyExc_BufferError, "attempt to access a null-pointer");
+        view->obj = nullptr;
+    }
+    return obj;
+}
+
+static int STLStringGetBuffer(PyObject* self, Py_buffer* view, int flags)
+{
+    std::string* s = BufferTarget<std::string>(self, view);
+    if (!s) return -1;
+    return PyBuffer_FillInfo(view, self, (void*)s->data(), (Py_ssize_t)s->size(), 0, flags);
+}
+
+static int StringViewGetBuffer(PyObject* self, Py_buffer* view, int flags)
+{
+    std::string_view* s = BufferTarget<std::string_view>(self, view);
+    if (!s) return -1;
+    return PyBuffer_FillInfo(view, self, (void*)s->data(), (Py_ssize_t)s->size(), 1, flags);
+}
+
+template<typename T>
+static int CharVectorGetBuffer(PyObject* self, Py_buffer* view, int flags)
+{
+    std::vector<T>* v = BufferTarget<std::vector<T>>(self, view);
+    if (!v) return -1;
+    return PyBuffer_FillInfo(view, self, (void*)v->data(), (Py_ssize_t)v->size(), 0, flags);
+}
+
+static void SetBufferProcs(PyObject* pyclass, getbufferproc getbuf)
+{
+// classes are heap types, which carry their own storage for the buffer procs
+    PyHeapTypeObject* ht = (PyHeapTypeObject*)pyclass;
+    ht->as_buffer.bf_getbuffer = getbuf;
+    ht->as_buffer.bf_releasebuffer = nullptr;
+    ((PyTypeObject*)pyclass)->tp_as_buffer = &ht->as_buffer;
+    PyType_Modified((PyTypeObject*)pyclass);
+}
+#endif
+
+
 //- string_view behavior as primitive ----------------------------------------
 PyObject* StringViewInit(PyObject* self, PyObject* args, PyObject* /* kwds */)
 {
@@ -1773,7 +2770,7 @@ bool CPyCppyy::Pythonize(PyObject* pyclass, const std::string& name)
                 }
                 initdef << "};\n} }";
 
-                if (Cppyy::Compile(initdef.str(), true /* silent */)) {
+                if (Utility::Compile(initdef.str(), true /* silent */)) {
                     Cppyy::TCppScope_t cis = Cppyy::GetScope("__cppyy_internal");
                     const auto& mix = Cppyy::GetMethodIndicesFromName(cis, "init_"+rname);
                     if (mix.size()) {
@@ -1796,6 +2793,14 @@ bool CPyCppyy::Pythonize(PyObject* pyclass, const std::string& name)
         if (klass->fCppType == sVectorBoolTypeID) {
             Utility::AddToClass(pyclass, "__getitem__", (PyCFunction)VectorBoolGetItem, METH_O);
             Utility::AddToClass(pyclass, "__setitem__", (PyCFunction)VectorBoolSetItem);
+
+        // bulk conversions of the packed bits
+            Utility::AddToClass(pyclass, "__real_init", "__init__");
+            Utility::AddToClass(pyclass, "__init__", (PyCFunction)VectorBoolInit, METH_VARARGS | METH_KEYWORDS);
+            Utility::AddToClass(pyclass, "tolist", (PyCFunction)VectorBoolToList, METH_NOARGS);
+            Utility::AddToClass(pyclass, "tobytes", (PyCFunction)VectorBoolToBytes, METH_NOARGS);
+            Utility::AddToClass(pyclass, "frombytes", (PyCFunction)VectorBoolFromBytes, METH_VARARGS);
+            Utility::AddToClass(pyclass, "__array__", (PyCFunction)VectorBoolArray, METH_VARARGS | METH_KEYWORDS);
         } else {
         // constructor that takes python collections
             Utility::AddToClass(pyclass, "__real_init", "__init__");
@@ -1808,6 +2813,17 @@ bool CPyCppyy::Pythonize(PyObject* pyclass, const std::string& name)
         // numpy array conversion
             Utility::AddToClass(pyclass, "__array__", (PyCFunction)VectorArray, METH_VARARGS | METH_KEYWORDS /* unused */);
 
+        // bulk conversions
+            Utility::AddToClass(pyclass, "tolist", (PyCFunction)VectorToList, METH_NOARGS);
+            Utility::AddToClass(pyclass, "tobytes", (PyCFunction)VectorToBytes, METH_NOARGS);
+
+        // zero-copy exchange with DLPack consumers
+            Utility::AddToClass(pyclass, "__dlpack__", (PyCFunction)VectorDLPack, METH_VARARGS | METH_KEYWORDS);
+            Utility::AddToClass(pyclass, "__dlpack_device__", (PyCFunction)VectorDLPackDevice, METH_NOARGS);
+
+        // columnar exchange with Arrow consumers
+            Utility::AddToClass(pyclass, "__arrow_c_array__", (PyCFunction)VectorArrowArray, METH_VARARGS | METH_KEYWORDS);
+
         // checked getitem
             if (HasAttrDirect(pyclass, PyStrings::gLen)) {
                 Utility::AddToClass(pyclass, "_getitem__unchecked", "__getitem__");
@@ -1828,6 +2844,16 @@ bool CPyCppyy::Pythonize(PyObject* pyclass, const std::string& name)
                 Py_DECREF(pyvalue_type);
             }
 
+#if PY_VERSION_HEX >= 0x03000000
+        // zero-copy access to byte storage
+            if (vtype == "char")
+                SetBufferProcs(pyclass, (getbufferproc)CharVectorGetBuffer<char>);
+            else if (vtype == "unsigned char")
+                SetBufferProcs(pyclass, (getbufferproc)CharVectorGetBuffer<unsigned char>);
+            else if (vtype == "signed char")
+                SetBufferProcs(pyclass, (getbufferproc)CharVectorGetBuffer<signed char>);
+#endif
+
             size_t typesz = Cppyy::SizeOf(name+"::value_type");
             if (typesz) {
                 PyObject* pyvalue_size = PyLong_FromSsize_t(typesz);
@@ -1841,12 +2867,28 @@ bool CPyCppyy::Pythonize(PyObject* pyclass, const std::string& name)
     // constructor that takes python associative collections
         Utility::AddToClass(pyclass, "__real_init", "__init__");
         Utility::AddToClass(pyclass, "__init__", (PyCFunction)ArrayInit, METH_VARARGS | METH_KEYWORDS);
+
+    // data with size, and numpy array conversion (same as for std::vector)
+        Utility::AddToClass(pyclass, "__real_data", "data");
+        Utility::AddToClass(pyclass, "data", (PyCFunction)VectorData);
+        Utility::AddToClass(pyclass, "__array__", (PyCFunction)VectorArray, METH_VARARGS | METH_KEYWORDS);
+        Utility::AddToClass(pyclass, "__dlpack__", (PyCFunction)VectorDLPack, METH_VARARGS | METH_KEYWORDS);
+        Utility::AddToClass(pyclass, "__dlpack_device__", (PyCFunction)VectorDLPackDevice, METH_NOARGS);
     }
 
     else if (IsTemplatedSTLClass(name, "map") || IsTemplatedSTLClass(name, "unordered_map")) {
     // constructor that takes python associative collections
         Utility::AddToClass(pyclass, "__real_init", "__init__");
         Utility::AddToClass(pyclass, "__init__", (PyCFunction)MapInit, METH_VARARGS | METH_KEYWORDS);
+        Utility::AddToClass(pyclass, "to_dict", (PyCFunction)MapToDict, METH_NOARGS);
+
+    // iteration without pair proxies; as keys() makes dict(m) and other mapping consumers
+    // do a __getitem__ per key, existing keys are looked up with find() when possible
+        Utility::AddToClass(pyclass, "items", (PyCFunction)MapItems, METH_NOARGS);
+        Utility::AddToClass(pyclass, "keys", (PyCFunction)MapKeys, METH_NOARGS);
+        Utility::AddToClass(pyclass, "values", (PyCFunction)MapValues, METH_NOARGS);
+        Utility::AddToClass(pyclass, "_getitem__unchecked", "__getitem__");
+        Utility::AddToClass(pyclass, "__getitem__", (PyCFunction)MapGetItem, METH_O);
 
         Utility::AddToClass(pyclass, "__contains__", (PyCFunction)STLContainsWithFind, METH_O);
     }
@@ -1896,11 +2938,21 @@ bool CPyCppyy::Pythonize(PyObject* pyclass, const std::string& name)
 
     // to allow use of std::string in dictionaries and findable with str
         ((PyTypeObject*)pyclass)->tp_hash = (hashfunc)STLStringHash;
+
+#if PY_VERSION_HEX >= 0x03000000
+    // zero-copy access to the characters
+        SetBufferProcs(pyclass, (getbufferproc)STLStringGetBuffer);
+#endif
     }
 
     else if (name == "std::basic_string_view<char>") {
         Utility::AddToClass(pyclass, "__real_init", "__init__");
         Utility::AddToClass(pyclass, "__init__", (PyCFunction)StringViewInit, METH_VARARGS | METH_KEYWORDS);
+
+#if PY_VERSION_HEX >= 0x03000000
+    // zero-copy, read-only, access to the characters
+        SetBufferProcs(pyclass, (getbufferproc)StringViewGetBuffer);
+#endif
     }
 
     else if (name == "std::basic_string<wchar_t,std::char_traits<wchar_t>,std::allocator<wchar_t> >") {
@@ -0,0 +1,718 @@
+// Bindings
+#include "CPyCppyy.h"
+#include "ReflectionCache.h"
+
+// Standard
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+
+//= in-memory cache ==========================================================
+namespace {
+
+enum EMethodFlags {
+    kIsPublicMethod   = 0x0001,
+    kIsConstructor    = 0x0002,
+    kIsStaticMethod   = 0x0004,
+    kIsMethodTemplate = 0x0008,
+    kHasTemplate      = 0x0010 };
+
+enum EDataFlags {
+    kIsPublicData     = 0x0001,
+    kIsStaticData     = 0x0002,
+    kIsConstData      = 0x0004,
+    kIsEnumData       = 0x0008 };
+
+struct MethodInfo {
+    std::string              fName;
+    std::string              fResultType;
+    std::vector<std::string> fArgTypes;
+    uint32_t                 fReqArgs;
+    uint32_t                 fFlags;
+};
+
+struct DataInfo {
+    std::string              fName;
+    std::string              fType;
+    uint32_t                 fFlags;
+    std::vector<int32_t>     fDims;
+};
+
+struct ClassInfo {
+    uint64_t                 fSize = 0;     // part of the check that the class is unchanged,
+    uint64_t                 fSignature = 0;    // with the hash of all method signatures
+    std::vector<MethodInfo>  fMethods;
+    std::vector<DataInfo>    fData;
+    std::set<std::string>    fNames;        // method names ...
+    std::set<std::string>    fTemplated;    // ... and those that also have templates
+};
+
+
+//= on-disk cache ============================================================
+// The file consists of a header, tables of fixed-size records, and a pool of
+// NUL-terminated strings that the records refer to by offset. Sections are
+// ordered by alignment requirements, so that the file can be used in place.
+const char     kMagic[8] = {'C', 'P', 'Y', 'R', 'E', 'F', 'L', '\0'};
+const uint32_t kVersion  = 3;
+
+struct FileHeader {
+    char     fMagic[8];
+    uint32_t fVersion;
+    uint32_t fPtrSize;
+    uint64_t fKey;                          // hash of the headers/libraries fingerprint
+    uint64_t fSize;                         // total file size
+    uint64_t fChecksum;                     // of everything after the header
+    uint32_t fNData;
+    uint32_t fNClasses;
+    uint32_t fNMethods;
+    uint32_t fNArgs;
+    uint32_t fNDims;
+    uint32_t fNStrings;                     // size of the string pool
+};
+
+struct DataRecord {
+    uint32_t fName, fType, fFlags, fFirstDim, fNDims;
+};
+
+struct ClassRecord {
+    uint64_t fSize, fSignature;
+    uint32_t fName, fFirstMethod, fNMethods, fFirstData, fNData, fPad;
+};
+
+struct MethodRecord {
+    uint32_t fName, fResultType, fFlags, fReqArgs, fFirstArg, fNArgs;
+};
+
+struct CacheFile {
+    const char*         fBase    = nullptr;
+    size_t              fSize    = 0;
+    bool                fMapped  = false;
+    const FileHeader*   fHeader  = nullptr;
+    const DataRecord*   fData    = nullptr;
+    const ClassRecord*  fClasses = nullptr;
+    const MethodRecord* fMethods = nullptr;
+    const uint32_t*     fArgs    = nullptr;
+    const int32_t*      fDims    = nullptr;
+    const char*         fStrings = nullptr;
+    std::unordered_map<std::string, uint32_t> fIndex;    // class name -> record
+};
+
+bool        gActive = false;
+bool        gDirty  = false;
+std::string gPath;
+uint64_t    gKey    = 0;
+CacheFile   gFile;
+
+// entries are never destroyed while the cache is open, as gClasses and gMethods
+// refer into them; a replaced entry is moved to gRetired
+std::map<std::string, std::unique_ptr<ClassInfo>>              gClassesByName;
+std::vector<std::unique_ptr<ClassInfo>>                        gRetired;
+std::unordered_map<Cppyy::TCppScope_t, ClassInfo*>             gClasses;    // nullptr if not cached
+std::unordered_map<Cppyy::TCppMethod_t, const MethodInfo*>     gMethods;
+
+//----------------------------------------------------------------------------
+uint64_t fnv1a(const char* data, size_t sz, uint64_t h = 14695981039346656037ull)
+{
+    for (size_t i = 0; i < sz; ++i) {
+        h ^= (uint8_t)data[i];
+        h *= 1099511628211ull;
+    }
+    return h;
+}
+
+//----------------------------------------------------------------------------
+class SignatureHash {
+public:
+    void add(const std::string& s) { fHash = fnv1a(s.c_str(), s.size()+1, fHash); }
+    uint64_t value() const { return fHash; }
+
+private:
+    uint64_t fHash = 14695981039346656037ull;
+};
+
+uint64_t GetSignatureHash(const ClassInfo& info)
+{
+    SignatureHash h;
+    for (const auto& mi : info.fMethods) {
+        h.add(mi.fName); h.add(mi.fResultType);
+        for (const auto& arg : mi.fArgTypes) h.add(arg);
+        h.add(";");
+    }
+    return h.value();
+}
+
+uint64_t GetSignatureHash(Cppyy::TCppScope_t scope)
+{
+// same as above, but straight from the backend, to validate cached entries
+    SignatureHash h;
+    const Cppyy::TCppIndex_t nMethods = Cppyy::GetNumMethods(scope);
+    for (Cppyy::TCppIndex_t imeth = 0; imeth < nMethods; ++imeth) {
+        Cppyy::TCppMethod_t method = Cppyy::GetMethod(scope, imeth);
+        h.add(Cppyy::GetMethodName(method)); h.add(Cppyy::GetMethodResultType(method));
+        const Cppyy::TCppIndex_t nArgs = Cppyy::GetMethodNumArgs(method);
+        for (Cppyy::TCppIndex_t iarg = 0; iarg < nArgs; ++iarg)
+            h.add(Cppyy::GetMethodArgType(method, iarg));
+        h.add(";");
+    }
+    return h.value();
+}
+
+//----------------------------------------------------------------------------
+void UnmapFile()
+{
+    if (gFile.fBase) {
+#ifndef _WIN32
+        if (gFile.fMapped) munmap((void*)gFile.fBase, gFile.fSize);
+        else
+#endif
+        free((void*)gFile.fBase);
+    }
+    gFile = CacheFile{};
+}
+
+bool MapFile()
+{
+// Map the cache file and validate it, leaving the cache empty on any failure
+    const char* base = nullptr; size_t sz = 0; bool mapped = false;
+#ifndef _WIN32
+    int fd = open(gPath.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+    struct stat st;
+    if (fstat(fd, &st) == 0 && (size_t)st.st_size >= sizeof(FileHeader)) {
+        sz = (size_t)st.st_size;
+        void* addr = mmap(nullptr, sz, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (addr != MAP_FAILED) { base = (const char*)addr; mapped = true; }
+    }
+    close(fd);
+#else
+    FILE* fp = fopen(gPath.c_str(), "rb");
+    if (!fp) return false;
+    fseek(fp, 0, SEEK_END);
+    long fsz = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    if (0 < fsz && (size_t)fsz >= sizeof(FileHeader)) {
+        char* buf = (char*)malloc((size_t)fsz);
+        if (buf && fread(buf, 1, (size_t)fsz, fp) == (size_t)fsz) { base = buf; sz = (size_t)fsz; }
+        else free(buf);
+    }
+    fclose(fp);
+#endif
+    if (!base) return false;
+
+    gFile.fBase = base; gFile.fSize = sz; gFile.fMapped = mapped;
+
+    const FileHeader* hdr = (const FileHeader*)base;
+    size_t expected = sizeof(FileHeader) +
+        (size_t)hdr->fNData*sizeof(DataRecord) + (size_t)hdr->fNClasses*sizeof(ClassRecord) +
+        (size_t)hdr->fNMethods*sizeof(MethodRecord) + (size_t)hdr->fNArgs*sizeof(uint32_t) +
+        (size_t)hdr->fNDims*sizeof(int32_t) + (size_t)hdr->fNStrings;
+    if (memcmp(hdr->fMagic, kMagic, sizeof(kMagic)) != 0 || hdr->fVersion != kVersion || \
+            hdr->fPtrSize != sizeof(void*) || hdr->fKey != gKey || hdr->fSize != sz || \
+            expected != sz || hdr->fNStrings == 0 || base[sz-1] != '\0' || \
+            hdr->fChecksum != fnv1a(base+sizeof(FileHeader), sz-sizeof(FileHeader))) {
+        UnmapFile();
+        return false;
+    }
+
+    const char* p = base + sizeof(FileHeader);
+    gFile.fHeader  = hdr;
+    gFile.fClasses = (const ClassRecord*)p;  p += hdr->fNClasses*sizeof(ClassRecord);
+    gFile.fData    = (const DataRecord*)p;   p += hdr->fNData*sizeof(DataRecord);
+    gFile.fMethods = (const MethodRecord*)p; p += hdr->fNMethods*sizeof(MethodRecord);
+    gFile.fArgs    = (const uint32_t*)p;     p += hdr->fNArgs*sizeof(uint32_t);
+    gFile.fDims    = (const int32_t*)p;      p += hdr->fNDims*sizeof(int32_t);
+    gFile.fStrings = p;
+
+    for (uint32_t icl = 0; icl < hdr->fNClasses; ++icl) {
+        if (gFile.fClasses[icl].fName < hdr->fNStrings)
+            gFile.fIndex[gFile.fStrings + gFile.fClasses[icl].fName] = icl;
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------
+bool DecodeClass(uint32_t icl, ClassInfo& info)
+{
+// Copy a class record from the file, checking all references
+    const FileHeader* hdr = gFile.fHeader;
+    const ClassRecord& cr = gFile.fClasses[icl];
+    if (hdr->fNMethods < cr.fFirstMethod || hdr->fNMethods - cr.fFirstMethod < cr.fNMethods || \
+            hdr->fNData < cr.fFirstData || hdr->fNData - cr.fFirstData < cr.fNData)
+        return false;
+
+    auto str = [hdr](uint32_t offset, std::string& s) {
+        if (hdr->fNStrings <= offset) return false;
+        s = gFile.fStrings + offset;
+        return true;
+    };
+
+    info.fSize = cr.fSize;
+    info.fSignature = cr.fSignature;
+    info.fMethods.resize(cr.fNMethods);
+    for (uint32_t im = 0; im < cr.fNMethods; ++im) {
+        const MethodRecord& mr = gFile.fMethods[cr.fFirstMethod+im];
+        MethodInfo& mi = info.fMethods[im];
+        if (!str(mr.fName, mi.fName) || !str(mr.fResultType, mi.fResultType) || \
+                hdr->fNArgs < mr.fFirstArg || hdr->fNArgs - mr.fFirstArg < mr.fNArgs)
+            return false;
+        mi.fReqArgs = mr.fReqArgs;
+        mi.fFlags   = mr.fFlags;
+        mi.fArgTypes.resize(mr.fNArgs);
+        for (uint32_t ia = 0; ia < mr.fNArgs; ++ia) {
+            if (!str(gFile.fArgs[mr.fFirstArg+ia], mi.fArgTypes[ia]))
+                return false;
+        }
+        info.fNames.insert(mi.fName);
+        if (mi.fFlags & kHasTemplate) info.fTemplated.insert(mi.fName);
+    }
+
+    info.fData.resize(cr.fNData);
+    for (uint32_t id = 0; id < cr.fNData; ++id) {
+        const DataRecord& dr = gFile.fData[cr.fFirstData+id];
+        DataInfo& di = info.fData[id];
+        if (!str(dr.fName, di.fName) || !str(dr.fType, di.fType) || \
+                hdr->fNDims < dr.fFirstDim || hdr->fNDims - dr.fFirstDim < dr.fNDims)
+            return false;
+        di.fFlags  = dr.fFlags;
+        di.fDims.assign(gFile.fDims+dr.fFirstDim, gFile.fDims+dr.fFirstDim+dr.fNDims);
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------
+void RecordClass(Cppyy::TCppScope_t scope, ClassInfo& info)
+{
+// Collect all reflection information of the given class from the backend; data
+// member offsets are not part of it, as a stale offset would silently corrupt
+// memory, whereas other mismatches fail loudly
+    info.fSize = (uint64_t)Cppyy::SizeOf(scope);
+    const Cppyy::TCppIndex_t nMethods = Cppyy::GetNumMethods(scope);
+    info.fMethods.resize(nMethods);
+    for (Cppyy::TCppIndex_t imeth = 0; imeth < nMethods; ++imeth) {
+        Cppyy::TCppMethod_t method = Cppyy::GetMethod(scope, imeth);
+        MethodInfo& mi = info.fMethods[imeth];
+        mi.fName       = Cppyy::GetMethodName(method);
+        mi.fResultType = Cppyy::GetMethodResultType(method);
+        mi.fReqArgs    = (uint32_t)Cppyy::GetMethodReqArgs(method);
+        const Cppyy::TCppIndex_t nArgs = Cppyy::GetMethodNumArgs(method);
+        for (Cppyy::TCppIndex_t iarg = 0; iarg < nArgs; ++iarg)
+            mi.fArgTypes.push_back(Cppyy::GetMethodArgType(method, iarg));
+        mi.fFlags = 0;
+        if (Cppyy::IsPublicMethod(method))          mi.fFlags |= kIsPublicMethod;
+        if (Cppyy::IsConstructor(method))           mi.fFlags |= kIsConstructor;
+        if (Cppyy::IsStaticMethod(method))          mi.fFlags |= kIsStaticMethod;
+        if (Cppyy::IsMethodTemplate(scope, imeth))  mi.fFlags |= kIsMethodTemplate;
+        if (info.fNames.insert(mi.fName).second && Cppyy::ExistsMethodTemplate(scope, mi.fName))
+            info.fTemplated.insert(mi.fName);
+    }
+    for (auto& mi : info.fMethods) {
+        if (info.fTemplated.find(mi.fName) != info.fTemplated.end())
+            mi.fFlags |= kHasTemplate;
+    }
+
+    const Cppyy::TCppIndex_t nData = Cppyy::GetNumDatamembers(scope);
+    info.fData.resize(nData);
+    for (Cppyy::TCppIndex_t idata = 0; idata < nData; ++idata) {
+        DataInfo& di = info.fData[idata];
+        di.fName  = Cppyy::GetDatamemberName(scope, idata);
+        di.fType  = Cppyy::GetDatamemberType(scope, idata);
+        di.fFlags = 0;
+        if (Cppyy::IsPublicData(scope, idata)) di.fFlags |= kIsPublicData;
+        if (Cppyy::IsStaticData(scope, idata)) di.fFlags |= kIsStaticData;
+        if (Cppyy::IsConstData(scope, idata))  di.fFlags |= kIsConstData;
+        if (Cppyy::IsEnumData(scope, idata))   di.fFlags |= kIsEnumData;
+        int size = 0;
+        while (0 < (size = Cppyy::GetDimensionSize(scope, idata, (int)di.fDims.size())))
+            di.fDims.push_back((int32_t)size);
+    }
+
+    info.fSignature = GetSignatureHash(info);
+}
+
+//----------------------------------------------------------------------------
+ClassInfo* GetClass(Cppyy::TCppScope_t scope)
+{
+// Find the cached information of the given class, loading it from the cache
+// file or recording it from the backend on first use
+    if (!gActive || !scope)
+        return nullptr;
+
+    auto cached = gClasses.find(scope);
+    if (cached != gClasses.end())
+        return cached->second;
+
+    ClassInfo* info = nullptr;
+    const std::string& name = Cppyy::GetScopedFinalName(scope);
+    if (!name.empty() && !Cppyy::IsNamespace(scope) && Cppyy::IsComplete(name)) {
+        const Cppyy::TCppIndex_t nMethods = Cppyy::GetNumMethods(scope);
+        const Cppyy::TCppIndex_t nData    = Cppyy::GetNumDatamembers(scope);
+
+        std::unique_ptr<ClassInfo>& known = gClassesByName[name];
+        if (!known) {
+            auto rec = gFile.fIndex.find(name);
+            if (rec != gFile.fIndex.end()) {
+                known.reset(new ClassInfo{});
+                if (!DecodeClass(rec->second, *known))
+                    known.reset();
+            }
+        }
+
+    // reject entries that no longer match the class as currently loaded
+        if (!known || known->fSize != (uint64_t)Cppyy::SizeOf(scope) || \
+                known->fMethods.size() != nMethods || known->fData.size() != nData || \
+                known->fSignature != GetSignatureHash(scope)) {
+            if (known) gRetired.push_back(std::move(known));
+            known.reset(new ClassInfo{});
+            RecordClass(scope, *known);
+            gDirty = true;
+        }
+        info = known.get();
+    }
+
+    gClasses[scope] = info;
+    return info;
+}
+
+inline const MethodInfo* GetMethodInfo(Cppyy::TCppMethod_t method)
+{
+    if (!gActive) return nullptr;
+    auto m = gMethods.find(method);
+    return m != gMethods.end() ? m->second : nullptr;
+}
+
+inline const DataInfo* GetDataInfo(Cppyy::TCppScope_t scope, Cppyy::TCppIndex_t idata)
+{
+    ClassInfo* info = GetClass(scope);
+    return (info && idata < info->fData.size()) ? &info->fData[idata] : nullptr;
+}
+
+//----------------------------------------------------------------------------
+class CacheWriter {
+public:
+    uint32_t AddString(const std::string& s) {
+        auto known = fOffsets.find(s);
+        if (known != fOffsets.end()) return known->second;
+        uint32_t offset = (uint32_t)fStrings.size();
+        fStrings.append(s.c_str(), s.size()+1);
+        fOffsets.emplace(s, offset);
+        return offset;
+    }
+
+    void AddClass(const std::string& name, const ClassInfo& info) {
+        ClassRecord cr{info.fSize, info.fSignature, AddString(name), (uint32_t)fMethods.size(),
+                       (uint32_t)info.fMethods.size(), (uint32_t)fData.size(), (uint32_t)info.fData.size(), 0};
+        fClasses.push_back(cr);
+        for (const auto& mi : info.fMethods) {
+            MethodRecord mr{AddString(mi.fName), AddString(mi.fResultType), mi.fFlags, mi.fReqArgs,
+                            (uint32_t)fArgs.size(), (uint32_t)mi.fArgTypes.size()};
+            for (const auto& arg : mi.fArgTypes)
+                fArgs.push_back(AddString(arg));
+            fMethods.push_back(mr);
+        }
+        for (const auto& di : info.fData) {
+            DataRecord dr{AddString(di.fName), AddString(di.fType), di.fFlags,
+                          (uint32_t)fDims.size(), (uint32_t)di.fDims.size()};
+            fDims.insert(fDims.end(), di.fDims.begin(), di.fDims.end());
+            fData.push_back(dr);
+        }
+    }
+
+    std::string Serialize() {
+        std::string body;
+        append(body, fClasses); append(body, fData); append(body, fMethods);
+        append(body, fArgs); append(body, fDims);
+        body += fStrings;
+
+        FileHeader hdr;
+        memset(&hdr, 0, sizeof(hdr));
+        memcpy(hdr.fMagic, kMagic, sizeof(kMagic));
+        hdr.fVersion  = kVersion;
+        hdr.fPtrSize  = sizeof(void*);
+        hdr.fKey      = gKey;
+        hdr.fSize     = sizeof(FileHeader) + body.size();
+        hdr.fChecksum = fnv1a(body.data(), body.size());
+        hdr.fNData    = (uint32_t)fData.size();
+        hdr.fNClasses = (uint32_t)fClasses.size();
+        hdr.fNMethods = (uint32_t)fMethods.size();
+        hdr.fNArgs    = (uint32_t)fArgs.size();
+        hdr.fNDims    = (uint32_t)fDims.size();
+        hdr.fNStrings = (uint32_t)fStrings.size();
+        return std::string((const char*)&hdr, sizeof(hdr)) + body;
+    }
+
+private:
+    template<typename T>
+    static void append(std::string& body, const std::vector<T>& v) {
+        body.append((const char*)v.data(), v.size()*sizeof(T));
+    }
+
+    std::vector<DataRecord>   fData;
+    std::vector<ClassRecord>  fClasses;
+    std::vector<MethodRecord> fMethods;
+    std::vector<uint32_t>     fArgs;
+    std::vector<int32_t>      fDims;
+    std::string               fStrings;
+    std::unordered_map<std::string, uint32_t> fOffsets;
+};
+
+//----------------------------------------------------------------------------
+void CloseCache()
+{
+    CPyCppyy::ReflectionCache::Flush();
+    UnmapFile();
+    gClassesByName.clear();
+    gRetired.clear();
+    gClasses.clear();
+    gMethods.clear();
+    gActive = false;
+}
+
+} // unnamed namespace
+
+
+//= public API ===============================================================
+bool CPyCppyy::ReflectionCache::Open(const std::string& path, const std::string& key)
+{
+// Use the cache file at the given path, if it was written for the same key;
+// returns true if an existing cache was loaded. Note that the key should be a
+// fingerprint of all headers and libraries that affect the cached classes.
+    static bool sAtExitRegistered = false;
+    if (!sAtExitRegistered) {
+        Py_AtExit(CloseCache);
+        sAtExitRegistered = true;
+    }
+
+    CloseCache();
+    if (path.empty())
+        return false;
+
+    gPath   = path;
+    gKey    = fnv1a(key.data(), key.size());
+    gDirty  = false;
+    gActive = true;
+
+    return MapFile();
+}
+
+//----------------------------------------------------------------------------
+bool CPyCppyy::ReflectionCache::IsActive()
+{
+    return gActive;
+}
+
+//----------------------------------------------------------------------------
+bool CPyCppyy::ReflectionCache::Flush()
+{
+// Write all known classes, including those in the current file that were not
+// used, to a temporary file that then atomically replaces the cache file.
+    if (!gActive || !gDirty)
+        return true;
+
+    CacheWriter writer;
+    for (const auto& cl : gClassesByName) {
+        if (cl.second) writer.AddClass(cl.first, *cl.second);
+    }
+    for (const auto& rec : gFile.fIndex) {
+        auto known = gClassesByName.find(rec.first);
+        if (known != gClassesByName.end() && known->second)
+            continue;
+        ClassInfo info;
+        if (DecodeClass(rec.second, info))
+            writer.AddClass(rec.first, info);
+    }
+    const std::string& data = writer.Serialize();
+
+#ifdef _WIN32
+    const std::string tmpPath = gPath + "." + std::to_string(_getpid()) + ".tmp";
+#else
+    const std::string tmpPath = gPath + "." + std::to_string(getpid()) + ".tmp";
+#endif
+    FILE* fp = fopen(tmpPath.c_str(), "wb");
+    if (!fp)
+        return false;
+    bool ok = fwrite(data.data(), 1, data.size(), fp) == data.size();
+    ok = (fclose(fp) == 0) && ok;
+#ifdef _WIN32
+    if (ok) remove(gPath.c_str());
+#endif
+    if (!ok || rename(tmpPath.c_str(), gPath.c_str()) != 0) {
+        remove(tmpPath.c_str());
+        return false;
+    }
+
+    gDirty = false;
+    return true;
+}
+
+//- cached reflection queries ------------------------------------------------
+Cppyy::TCppIndex_t CPyCppyy::ReflectionCache::GetNumMethods(Cppyy::TCppScope_t scope)
+{
+    if (ClassInfo* info = GetClass(scope))
+        return info->fMethods.size();
+    return Cppyy::GetNumMethods(scope);
+}
+
+Cppyy::TCppMethod_t CPyCppyy::ReflectionCache::GetMethod(
+    Cppyy::TCppScope_t scope, Cppyy::TCppIndex_t imeth)
+{
+// methods are identified by handle in the other queries, so track which record
+// belongs to each handle handed out
+    Cppyy::TCppMethod_t method = Cppyy::GetMethod(scope, imeth);
+    ClassInfo* info = GetClass(scope);
+    if (info && method && imeth < info->fMethods.size())
+        gMethods[method] = &info->fMethods[imeth];
+    return method;
+}
+
+std::string CPyCppyy::ReflectionCache::GetMethodName(Cppyy::TCppMethod_t method)
+{
+    if (const MethodInfo* mi = GetMethodInfo(method))
+        return mi->fName;
+    return Cppyy::GetMethodName(method);
+}
+
+std::string CPyCppyy::ReflectionCache::GetMethodResultType(Cppyy::TCppMethod_t method)
+{
+    if (const MethodInfo* mi = GetMethodInfo(method))
+        return mi->fResultType;
+    return Cppyy::GetMethodResultType(method);
+}
+
+Cppyy::TCppIndex_t CPyCppyy::ReflectionCache::GetMethodNumArgs(Cppyy::TCppMethod_t method)
+{
+    if (const MethodInfo* mi = GetMethodInfo(method))
+        return mi->fArgTypes.size();
+    return Cppyy::GetMethodNumArgs(method);
+}
+
+Cppyy::TCppIndex_t CPyCppyy::ReflectionCache::GetMethodReqArgs(Cppyy::TCppMethod_t method)
+{
+    if (const MethodInfo* mi = GetMethodInfo(method))
+        return mi->fReqArgs;
+    return Cppyy::GetMethodReqArgs(method);
+}
+
+std::string CPyCppyy::ReflectionCache::GetMethodArgType(
+    Cppyy::TCppMethod_t method, Cppyy::TCppIndex_t iarg)
+{
+    const MethodInfo* mi = GetMethodInfo(method);
+    if (mi && iarg < mi->fArgTypes.size())
+        return mi->fArgTypes[iarg];
+    return Cppyy::GetMethodArgType(method, iarg);
+}
+
+bool CPyCppyy::ReflectionCache::IsPublicMethod(Cppyy::TCppMethod_t method)
+{
+    if (const MethodInfo* mi = GetMethodInfo(method))
+        return mi->fFlags & kIsPublicMethod;
+    return Cppyy::IsPublicMethod(method);
+}
+
+bool CPyCppyy::ReflectionCache::IsConstructor(Cppyy::TCppMethod_t method)
+{
+    if (const MethodInfo* mi = GetMethodInfo(method))
+        return mi->fFlags & kIsConstructor;
+    return Cppyy::IsConstructor(method);
+}
+
+bool CPyCppyy::ReflectionCache::IsStaticMethod(Cppyy::TCppMethod_t method)
+{
+    if (const MethodInfo* mi = GetMethodInfo(method))
+        return mi->fFlags & kIsStaticMethod;
+    return Cppyy::IsStaticMethod(method);
+}
+
+bool CPyCppyy::ReflectionCache::IsMethodTemplate(Cppyy::TCppScope_t scope, Cppyy::TCppIndex_t imeth)
+{
+    ClassInfo* info = GetClass(scope);
+    if (info && imeth < info->fMethods.size())
+        return info->fMethods[imeth].fFlags & kIsMethodTemplate;
+    return Cppyy::IsMethodTemplate(scope, imeth);
+}
+
+bool CPyCppyy::ReflectionCache::ExistsMethodTemplate(Cppyy::TCppScope_t scope, const std::string& name)
+{
+// only names of methods are cached; anything else may have been added since
+    ClassInfo* info = GetClass(scope);
+    if (info && info->fNames.find(name) != info->fNames.end())
+        return info->fTemplated.find(name) != info->fTemplated.end();
+    return Cppyy::ExistsMethodTemplate(scope, name);
+}
+
+//----------------------------------------------------------------------------
+Cppyy::TCppIndex_t CPyCppyy::ReflectionCache::GetNumDatamembers(Cppyy::TCppScope_t scope)
+{
+    if (ClassInfo* info = GetClass(scope))
+        return info->fData.size();
+    return Cppyy::GetNumDatamembers(scope);
+}
+
+std::string CPyCppyy::ReflectionCache::GetDatamemberName(Cppyy::TCppScope_t scope, Cppyy::TCppIndex_t idata)
+{
+    if (const DataInfo* di = GetDataInfo(scope, idata))
+        return di->fName;
+    return Cppyy::GetDatamemberName(scope, idata);
+}
+
+std::string CPyCppyy::ReflectionCache::GetDatamemberType(Cppyy::TCppScope_t scope, Cppyy::TCppIndex_t idata)
+{
+    if (const DataInfo* di = GetDataInfo(scope, idata))
+        return di->fType;
+    return Cppyy::GetDatamemberType(scope, idata);
+}
+
+bool CPyCppyy::ReflectionCache::IsPublicData(Cppyy::TCppScope_t scope, Cppyy::TCppIndex_t idata)
+{
+    if (const DataInfo* di = GetDataInfo(scope, idata))
+        return di->fFlags & kIsPublicData;
+    return Cppyy::IsPublicData(scope, idata);
+}
+
+bool CPyCppyy::ReflectionCache::IsStaticData(Cppyy::TCppScope_t scope, Cppyy::TCppIndex_t idata)
+{
+    if (const DataInfo* di = GetDataInfo(scope, idata))
+        return di->fFlags & kIsStaticData;
+    return Cppyy::IsStaticData(scope, idata);
+}
+
+bool CPyCppyy::ReflectionCache::IsConstData(Cppyy::TCppScope_t scope, Cppyy::TCppIndex_t idata)
+{
+    if (const DataInfo* di = GetDataInfo(scope, idata))
+        return di->fFlags & kIsConstData;
+    return Cppyy::IsConstData(scope, idata);
+}
+
+bool CPyCppyy::ReflectionCache::IsEnumData(Cppyy::TCppScope_t scope, Cppyy::TCppIndex_t idata)
+{
+    if (const DataInfo* di = GetDataInfo(scope, idata))
+        return di->fFlags & kIsEnumData;
+    return Cppyy::IsEnumData(scope, idata);
+}
+
+int CPyCppyy::ReflectionCache::GetDimensionSize(
+    Cppyy::TCppScope_t scope, Cppyy::TCppIndex_t idata, int dimension)
+{
+    const DataInfo* di = GetDataInfo(scope, idata);
+    if (di)
+        return (0 <= dimension && (size_t)dimension < di->fDims.size()) ? (int)di->fDims[dimension] : -1;
+    return Cppyy::GetDimensionSize(scope, idata, dimension);
+}
@@ -0,0 +1,54 @@
+#ifndef CPYCPPYY_REFLECTIONCACHE_H
+#define CPYCPPYY_REFLECTIONCACHE_H
+
+// Standard
+#include <string>
+
+
+namespace CPyCppyy {
+
+/** Optional, persistent, cache of the per-class reflection information that is
+    consumed when building class proxies, setting up method dispatch, and
+    creating data members. The cache file is memory-mapped and only accepted if
+    it was written for the same fingerprint of loaded headers and libraries;
+    classes recorded in the current process are added to it on exit.
+ */
+
+namespace ReflectionCache {
+
+// use the cache file at 'path' for the given fingerprint ('key')
+    bool Open(const std::string& path, const std::string& key);
+    bool IsActive();
+
+// write all entries to the cache file (done automatically at exit)
+    bool Flush();
+
+// cached editions of the backend queries; these defer to the backend if the
+// cache is not active or the queried scope or method is not part of it
+    Cppyy::TCppIndex_t  GetNumMethods(Cppyy::TCppScope_t scope);
+    Cppyy::TCppMethod_t GetMethod(Cppyy::TCppScope_t scope, Cppyy::TCppIndex_t imeth);
+    std::string GetMethodName(Cppyy::TCppMethod_t);
+    std::string GetMethodResultType(Cppyy::TCppMethod_t);
+    Cppyy::TCppIndex_t GetMethodNumArgs(Cppyy::TCppMethod_t);
+    Cppyy::TCppIndex_t GetMethodReqArgs(Cppyy::TCppMethod_t);
+    std::string GetMethodArgType(Cppyy::TCppMethod_t, Cppyy::TCppIndex_t iarg);
+    bool IsPublicMethod(Cppyy::TCppMethod_t);
+    bool IsConstructor(Cppyy::TCppMethod_t);
+    bool IsStaticMethod(Cppyy::TCppMethod_t);
+    bool IsMethodTemplate(Cppyy::TCppScope_t scope, Cppyy::TCppIndex_t imeth);
+    bool ExistsMethodTemplate(Cppyy::TCppScope_t scope, const std::string& name);
+
+    Cppyy::TCppIndex_t GetNumDatamembers(Cppyy::TCppScope_t scope);
+    std::string GetDatamemberName(Cppyy::TCppScope_t scope, Cppyy::TCppIndex_t idata);
+    std::string GetDatamemberType(Cppyy::TCppScope_t scope, Cppyy::TCppIndex_t idata);
+    bool IsPublicData(Cppyy::TCppScope_t scope, Cppyy::TCppIndex_t idata);
+    bool IsStaticData(Cppyy::TCppScope_t scope, Cppyy::TCppIndex_t idata);
+    bool IsConstData(Cppyy::TCppScope_t scope, Cppyy::TCppIndex_t idata);
+    bool IsEnumData(Cppyy::TCppScope_t scope, Cppyy::TCppIndex_t idata);
+    int  GetDimensionSize(Cppyy::TCppScope_t scope, Cppyy::TCppIndex_t idata, int dimension);
+
+} // namespace ReflectionCache
+
+} // namespace CPyCppyy
+
+#endif // !CPYCPPYY_REFLECTIONCACHE_H
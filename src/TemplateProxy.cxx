@@ -18,7 +18,7 @@ namespace CPyCppyy {
 
 //----------------------------------------------------------------------------
 TemplateInfo::TemplateInfo() : fPyClass(nullptr), fNonTemplated(nullptr),
-    fTemplated(nullptr), fLowPriority(nullptr), fDoc(nullptr)
+    fTemplated(nullptr), fLowPriority(nullptr), fTemplateArgsCache(nullptr), fDoc(nullptr)
 {
     /* empty */
 }
@@ -38,6 +38,16 @@ TemplateInfo::~TemplateInfo()
             Py_DECREF(c.second);
         }
     }
+
+    for (const auto& p : fTypedDispatchMap) {
+        for (const auto& e : p.second) {
+            Py_XDECREF(e.fTemplateArgs);
+            for (auto sig : e.fSignature)
+                Py_DECREF((PyObject*)(sig & ~(uintptr_t)1));
+            Py_DECREF(e.fMethod);
+        }
+    }
+    Py_XDECREF(fTemplateArgsCache);
 }
 
 
@@ -206,95 +216,108 @@ PyObject* TemplateProxy::Instantiate(const std::string& fname,
             }
         }
 
-        bool bExactMatch = fname == resname;
+        bool bNeedsRebind = !Cppyy::IsNamespace(scope) && !Cppyy::IsStaticMethod(cppmeth);
+        PyObject* pyol = AddInstantiation(fname, cppmeth, resname);
+        if (!pyol)
+            return nullptr;
 
-    // lookup on existing name in case this was an overload, not a caching, failure
-        PyObject* dct = PyObject_GetAttr(fTI->fPyClass, PyStrings::gDict);
-        PyObject* pycachename = CPyCppyy_PyText_InternFromString(fname.c_str());
-        PyObject* pyol = PyObject_GetItem(dct, pycachename);
-        if (!pyol) PyErr_Clear();
-        bool bIsCppOL = CPPOverload_Check(pyol);
+    // retrieve fresh (for boundedness) and call
+        PyObject* pymeth =
+            CPPOverload_Type.tp_descr_get(pyol, bNeedsRebind ? fSelf : nullptr, (PyObject*)&CPPOverload_Type);
+        Py_DECREF(pyol);
+        return pymeth;
+    }
 
-        if (pyol && !bIsCppOL && !TemplateProxy_Check(pyol)) {
-        // unknown object ... leave well alone
-            Py_DECREF(pyol);
-            Py_DECREF(pycachename);
-            Py_DECREF(dct);
-            return nullptr;
-        }
+    PyErr_Format(PyExc_TypeError, "Failed to instantiate \"%s(%s)\"", fname.c_str(), proto.c_str());
+    return nullptr;
+}
 
-    // find the full name if the requested one was partial
-        PyObject* exact = nullptr;
-        PyObject* pyresname = CPyCppyy_PyText_FromString(resname.c_str());
-        if (!bExactMatch) {
-            exact = PyObject_GetItem(dct, pyresname);
-            if (!exact) PyErr_Clear();
-        }
+
+//----------------------------------------------------------------------------
+PyObject* TemplateProxy::AddInstantiation(const std::string& fname,
+    Cppyy::TCppMethod_t cppmeth, const std::string& resname)
+{
+// Cache the given instantiation under the requested name (and under its full name
+// if the request was partial); returns the overload holding it (new reference)
+    Cppyy::TCppScope_t scope = ((CPPClass*)fTI->fPyClass)->fCppType;
+    bool bExactMatch = fname == resname;
+
+// lookup on existing name in case this was an overload, not a caching, failure
+    PyObject* dct = PyObject_GetAttr(fTI->fPyClass, PyStrings::gDict);
+    PyObject* pycachename = CPyCppyy_PyText_InternFromString(fname.c_str());
+    PyObject* pyol = PyObject_GetItem(dct, pycachename);
+    if (!pyol) PyErr_Clear();
+    bool bIsCppOL = CPPOverload_Check(pyol);
+
+    if (pyol && !bIsCppOL && !TemplateProxy_Check(pyol)) {
+    // unknown object ... leave well alone
+        Py_DECREF(pyol);
+        Py_DECREF(pycachename);
         Py_DECREF(dct);
+        return nullptr;
+    }
 
-        bool bIsConstructor = false, bNeedsRebind = true;
-
-        PyCallable* meth = nullptr;
-        if (Cppyy::IsNamespace(scope)) {
-            meth = new CPPFunction(scope, cppmeth);
-            bNeedsRebind = false;
-        } else if (Cppyy::IsStaticMethod(cppmeth)) {
-            meth = new CPPClassMethod(scope, cppmeth);
-            bNeedsRebind = false;
-        } else if (Cppyy::IsConstructor(cppmeth)) {
-            bIsConstructor = true;
-            meth = new CPPConstructor(scope, cppmeth);
-        } else
-            meth = new CPPMethod(scope, cppmeth);
-
-    // Case 1/2: method simply did not exist before
-        if (!pyol) {
-        // actual overload to use (now owns meth)
-            pyol = (PyObject*)CPPOverload_New(fname, meth);
-            if (bIsConstructor) {
-            // TODO: this is an ugly hack :(
-                ((CPPOverload*)pyol)->fMethodInfo->fFlags |= \
-                    CallContext::kIsCreator | CallContext::kIsConstructor;
-            }
+// find the full name if the requested one was partial
+    PyObject* exact = nullptr;
+    PyObject* pyresname = CPyCppyy_PyText_FromString(resname.c_str());
+    if (!bExactMatch) {
+        exact = PyObject_GetItem(dct, pyresname);
+        if (!exact) PyErr_Clear();
+    }
+    Py_DECREF(dct);
 
-        // add to class dictionary
-            PyType_Type.tp_setattro(fTI->fPyClass, pycachename, pyol);
-        }
+    bool bIsConstructor = false;
 
-    // Case 3/4: pre-existing method that was either not found b/c the full
-    // templated name was constructed in this call or it failed as overload
-        else if (bIsCppOL) {
-        // TODO: see above, since the call hasn't happened yet, this overload may
-        // already exist and fail again.
-            ((CPPOverload*)pyol)->AdoptMethod(meth);   // takes ownership
-        }
+    PyCallable* meth = nullptr;
+    if (Cppyy::IsNamespace(scope)) {
+        meth = new CPPFunction(scope, cppmeth);
+    } else if (Cppyy::IsStaticMethod(cppmeth)) {
+        meth = new CPPClassMethod(scope, cppmeth);
+    } else if (Cppyy::IsConstructor(cppmeth)) {
+        bIsConstructor = true;
+        meth = new CPPConstructor(scope, cppmeth);
+    } else
+        meth = new CPPMethod(scope, cppmeth);
 
-    // Case 5: must be a template proxy, meaning that current template name is not
-    // a template overload
-        else {
-            ((TemplateProxy*)pyol)->AdoptTemplate(meth->Clone());
-            Py_DECREF(pyol);
-            pyol = (PyObject*)CPPOverload_New(fname, meth);      // takes ownership
+// Case 1/2: method simply did not exist before
+    if (!pyol) {
+    // actual overload to use (now owns meth)
+        pyol = (PyObject*)CPPOverload_New(fname, meth);
+        if (bIsConstructor) {
+        // TODO: this is an ugly hack :(
+            ((CPPOverload*)pyol)->fMethodInfo->fFlags |= \
+                CallContext::kIsCreator | CallContext::kIsConstructor;
         }
 
-    // Special Case if name was aliased (e.g. typedef in template instantiation)
-        if (!exact && !bExactMatch) {
-            PyType_Type.tp_setattro(fTI->fPyClass, pyresname, pyol);
-        }
+    // add to class dictionary
+        PyType_Type.tp_setattro(fTI->fPyClass, pycachename, pyol);
+    }
 
-    // cleanup
-        Py_DECREF(pyresname);
-        Py_DECREF(pycachename);
+// Case 3/4: pre-existing method that was either not found b/c the full
+// templated name was constructed in this call or it failed as overload
+    else if (bIsCppOL) {
+    // TODO: see above, since the call hasn't happened yet, this overload may
+    // already exist and fail again.
+        ((CPPOverload*)pyol)->AdoptMethod(meth);   // takes ownership
+    }
 
-    // retrieve fresh (for boundedness) and call
-        PyObject* pymeth =
-            CPPOverload_Type.tp_descr_get(pyol, bNeedsRebind ? fSelf : nullptr, (PyObject*)&CPPOverload_Type);
+// Case 5: must be a template proxy, meaning that current template name is not
+// a template overload
+    else {
+        ((TemplateProxy*)pyol)->AdoptTemplate(meth->Clone());
         Py_DECREF(pyol);
-        return pymeth;
+        pyol = (PyObject*)CPPOverload_New(fname, meth);      // takes ownership
     }
 
-    PyErr_Format(PyExc_TypeError, "Failed to instantiate \"%s(%s)\"", fname.c_str(), proto.c_str());
-    return nullptr;
+// Special Case if name was aliased (e.g. typedef in template instantiation)
+    if (!exact && !bExactMatch) {
+        PyType_Type.tp_setattro(fTI->fPyClass, pyresname, pyol);
+    }
+
+// cleanup
+    Py_DECREF(pyresname);
+    Py_DECREF(pycachename);
+    return pyol;
 }
 
 
@@ -446,6 +469,65 @@ static inline void UpdateDispatchMap(TemplateProxy* pytmpl, bool use_targs, uint
     if (!bInserted) v.push_back(std::make_pair(sighash, pymeth));
 }
 
+static inline uintptr_t ArgSignature(PyObject* pyobj)
+{
+// type of the argument, tagged if a temporary (see HashSignature)
+    return (uintptr_t)Py_TYPE(pyobj) | (pyobj->ob_refcnt == 1 ? 1 : 0);
+}
+
+static inline bool MatchSignature(const TP_TypedEntry_t& entry, PyObject* targs,
+    CPyCppyy_PyArgs_t args, Py_ssize_t argc)
+{
+    if (entry.fTemplateArgs != targs || (Py_ssize_t)entry.fSignature.size() != argc)
+        return false;
+    for (Py_ssize_t i = 0; i < argc; ++i) {
+        if (entry.fSignature[i] != ArgSignature(CPyCppyy_PyArgs_GET_ITEM(args, i)))
+            return false;
+    }
+    return true;
+}
+
+static inline CPPOverload* FindTypedDispatch(TemplateProxy* pytmpl,
+    CPyCppyy_PyArgs_t args, Py_ssize_t argc, uint64_t sighash)
+{
+// Exact lookup of a previously successful overload for these argument types.
+    auto& tdm = pytmpl->fTI->fTypedDispatchMap;
+    auto v = tdm.find(sighash);
+    if (v != tdm.end()) {
+        for (const auto& entry : v->second) {
+            if (MatchSignature(entry, pytmpl->fTemplateArgs, args, argc))
+                return entry.fMethod;
+        }
+    }
+    return nullptr;
+}
+
+static inline void UpdateTypedDispatch(TemplateProxy* pytmpl,
+    CPyCppyy_PyArgs_t args, Py_ssize_t argc, uint64_t sighash, CPPOverload* pymeth)
+{
+// Memoize a method by argument types after successful call, replacing a previous one.
+    auto& v = pytmpl->fTI->fTypedDispatchMap[sighash];
+
+    Py_INCREF(pymeth);
+    for (auto& entry : v) {
+        if (MatchSignature(entry, pytmpl->fTemplateArgs, args, argc)) {
+            Py_DECREF(entry.fMethod);
+            entry.fMethod = pymeth;
+            return;
+        }
+    }
+
+    TP_TypedEntry_t entry{pytmpl->fTemplateArgs, {}, pymeth};
+    Py_XINCREF(entry.fTemplateArgs);
+    entry.fSignature.reserve(argc);
+    for (Py_ssize_t i = 0; i < argc; ++i) {
+        PyObject* pyobj = CPyCppyy_PyArgs_GET_ITEM(args, i);
+        Py_INCREF((PyObject*)Py_TYPE(pyobj));   // keeps the type (and its address) alive
+        entry.fSignature.push_back(ArgSignature(pyobj));
+    }
+    v.push_back(std::move(entry));
+}
+
 static inline PyObject* SelectAndForward(TemplateProxy* pytmpl, CPPOverload* pymeth,
     CPyCppyy_PyArgs_t args, size_t nargsf, PyObject* kwds,
     bool implicitOkay, bool use_targs, uint64_t sighash, std::vector<Utility::PyError_t>& errors)
@@ -463,6 +545,7 @@ static inline PyObject* SelectAndForward(TemplateProxy* pytmpl, CPPOverload* pym
         Py_DECREF(pycall);
         if (result) {
             UpdateDispatchMap(pytmpl, use_targs, sighash, pymeth);
+            UpdateTypedDispatch(pytmpl, args, CPyCppyy_PyArgs_GET_SIZE(args, nargsf), sighash, pymeth);
             TPPCALL_RETURN;
         }
         Utility::FetchError(errors);
@@ -495,12 +578,28 @@ static inline PyObject* CallMethodImp(TemplateProxy* pytmpl, PyObject*& pymeth,
     if (result) {
         Py_XDECREF(((CPPOverload*)pymeth)->fSelf); ((CPPOverload*)pymeth)->fSelf = nullptr;    // unbind
         UpdateDispatchMap(pytmpl, true, sighash, (CPPOverload*)pymeth);
+        UpdateTypedDispatch(pytmpl, args, CPyCppyy_PyArgs_GET_SIZE(args, nargsf), sighash, (CPPOverload*)pymeth);
     }
 
     Py_DECREF(pymeth); pymeth = nullptr;
     return result;
 }
 
+//----------------------------------------------------------------------------
+static inline PyObject* CallDispatched(TemplateProxy* pytmpl, CPPOverload* ol,
+    CPyCppyy_PyArgs_t args, size_t nargsf, PyObject* kwds)
+{
+// call a memoized overload, bound to self if there is one
+    if (!pytmpl->fSelf || pytmpl->fSelf == Py_None)
+        return CPyCppyy_tp_call((PyObject*)ol, args, nargsf, kwds);
+
+    PyObject* pymeth = CPPOverload_Type.tp_descr_get(
+        (PyObject*)ol, pytmpl->fSelf, (PyObject*)&CPPOverload_Type);
+    PyObject* result = CPyCppyy_tp_call(pymeth, args, nargsf, kwds);
+    Py_DECREF(pymeth);
+    return result;
+}
+
 #if PY_VERSION_HEX >= 0x03080000
 static PyObject* tpp_vectorcall(
     TemplateProxy* pytmpl, PyObject* const *args, size_t nargsf, PyObject* kwds)
@@ -542,13 +641,25 @@ static PyObject* tpp_call(TemplateProxy* pytmpl, PyObject* args, PyObject* kwds)
 
     PyObject *pymeth = nullptr, *result = nullptr;
 
-// short-cut through memoization map
+// short-cut through memoization maps: exact on the argument types (which covers
+// explicit template arguments as well), then on the signature hash only
     Py_ssize_t argc = CPyCppyy_PyArgs_GET_SIZE(args, nargsf);
     uint64_t sighash = HashSignature(args, argc);
 
-    CPPOverload* ol = nullptr;
+// container for collecting errors
+    std::vector<Utility::PyError_t> errors;
+
+    CPPOverload* typed = FindTypedDispatch(pytmpl, args, argc, sighash);
+    if (typed) {
+        result = CallDispatched(pytmpl, typed, args, nargsf, kwds);
+        if (result)
+            return result;
+        Utility::FetchError(errors);
+    }
+
     if (!pytmpl->fTemplateArgs) {
     // look for known signatures ...
+        CPPOverload* ol = nullptr;
         auto& v = pytmpl->fTI->fDispatchMap[""];
         for (const auto& p : v) {
             if (p.first == sighash) {
@@ -557,24 +668,14 @@ static PyObject* tpp_call(TemplateProxy* pytmpl, PyObject* args, PyObject* kwds)
             }
         }
 
-        if (ol != nullptr) {
-            if (!pytmpl->fSelf || pytmpl->fSelf == Py_None) {
-                result = CPyCppyy_tp_call((PyObject*)ol, args, nargsf, kwds);
-            } else {
-                pymeth = CPPOverload_Type.tp_descr_get(
-                    (PyObject*)ol, pytmpl->fSelf, (PyObject*)&CPPOverload_Type);
-                result = CPyCppyy_tp_call(pymeth, args, nargsf, kwds);
-                Py_DECREF(pymeth); pymeth = nullptr;
-            }
+        if (ol && ol != typed) {
+            result = CallDispatched(pytmpl, ol, args, nargsf, kwds);
             if (result)
-                return result;
+                TPPCALL_RETURN;
+            Utility::FetchError(errors);
         }
     }
 
-// container for collecting errors
-    std::vector<Utility::PyError_t> errors;
-    if (ol) Utility::FetchError(errors);
-
 // case 1: explicit template previously selected through subscript
     if (pytmpl->fTemplateArgs) {
     // instantiate explicitly
@@ -705,6 +806,44 @@ static TemplateProxy* tpp_descr_get(TemplateProxy* pytmpl, PyObject* pyobj, PyOb
 }
 
 
+//----------------------------------------------------------------------------
+static bool IsCacheableTemplateArg(PyObject* arg)
+{
+// types and names only: numbers compare equal across types (1 == True == 1.0)
+    return PyType_Check(arg) || CPyCppyy_PyText_Check(arg);
+}
+
+static PyObject* TemplateArgsString(TemplateProxy* pytmpl, PyObject* args)
+{
+// Build the interned template arguments string for the given subscript, through the
+// cache if the subscript consists of types and names only.
+    bool cacheable = PyTuple_CheckExact(args) ? true : IsCacheableTemplateArg(args);
+    for (Py_ssize_t i = 0; cacheable && PyTuple_CheckExact(args) && i < PyTuple_GET_SIZE(args); ++i)
+        cacheable = IsCacheableTemplateArg(PyTuple_GET_ITEM(args, i));
+
+    PyObject*& cache = pytmpl->fTI->fTemplateArgsCache;
+    if (cacheable && cache) {
+        PyObject* pytargs = PyDict_GetItem(cache, args);
+        if (pytargs) {
+            Py_INCREF(pytargs);
+            return pytargs;
+        }
+    }
+
+    const std::string& targs = Utility::ConstructTemplateArgs(nullptr, args);
+    if (PyErr_Occurred())
+        return nullptr;
+    PyObject* pytargs = CPyCppyy_PyText_InternFromString(targs.c_str());
+
+    if (cacheable && !targs.empty()) {
+        if (!cache) cache = PyDict_New();
+        if (PyDict_SetItem(cache, args, pytargs) != 0)
+            PyErr_Clear();
+    }
+
+    return pytargs;
+}
+
 //----------------------------------------------------------------------------
 static PyObject* tpp_subscript(TemplateProxy* pytmpl, PyObject* args)
 {
@@ -713,8 +852,11 @@ static PyObject* tpp_subscript(TemplateProxy* pytmpl, PyObject* args)
 // to template specializations.
     TemplateProxy* typeBoundMethod = tpp_descr_get(pytmpl, pytmpl->fSelf, nullptr);
     Py_XDECREF(typeBoundMethod->fTemplateArgs);
-    typeBoundMethod->fTemplateArgs = CPyCppyy_PyText_FromString(
-        Utility::ConstructTemplateArgs(nullptr, args).c_str());
+    typeBoundMethod->fTemplateArgs = TemplateArgsString(pytmpl, args);
+    if (!typeBoundMethod->fTemplateArgs) {
+        Py_DECREF(typeBoundMethod);
+        return nullptr;
+    }
     return (PyObject*)typeBoundMethod;
 }
 
@@ -9,6 +9,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -24,6 +25,15 @@ class CPPOverload;
 typedef std::pair<uint64_t, CPPOverload*> TP_DispatchEntry_t;
 typedef std::map<std::string, std::vector<TP_DispatchEntry_t>> TP_DispatchMap_t;
 
+// exact dispatch on the (interned) explicit template arguments and the types of the
+// arguments, with the low bit of the type set for temporaries, as in HashSignature
+struct TP_TypedEntry_t {
+    PyObject*              fTemplateArgs;
+    std::vector<uintptr_t> fSignature;
+    CPPOverload*           fMethod;
+};
+typedef std::unordered_map<uint64_t, std::vector<TP_TypedEntry_t>> TP_TypedDispatchMap_t;
+
 class TemplateInfo {
 public:
     TemplateInfo();
@@ -39,6 +49,8 @@ public:
     CPPOverload* fLowPriority;    // low priority overloads such as void*/void**
 
     TP_DispatchMap_t fDispatchMap;
+    TP_TypedDispatchMap_t fTypedDispatchMap;
+    PyObject* fTemplateArgsCache;  // explicit template arguments -> interned string
     PyObject* fDoc;
 };
 
@@ -66,6 +78,8 @@ public:
     void AdoptTemplate(PyCallable* pc);
     PyObject* Instantiate(const std::string& fname,
         CPyCppyy_PyArgs_t tmplArgs, size_t nargsf, Utility::ArgPreference, int* pcnt = nullptr);
+    PyObject* AddInstantiation(const std::string& fname,
+        Cppyy::TCppMethod_t cppmeth, const std::string& resname);
 
 private:                // private, as the python C-API will handle creation
     TemplateProxy() = delete;
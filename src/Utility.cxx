@@ -4,10 +4,12 @@
 #include "CPPFunction.h"
 #include "CPPInstance.h"
 #include "CPPOverload.h"
+#include "CPPScope.h"
 #include "ProxyWrappers.h"
 #include "PyCallable.h"
 #include "PyStrings.h"
 #include "CustomPyTypes.h"
+#include "DLPack.h"
 #include "TemplateProxy.h"
 #include "TypeManip.h"
 
@@ -19,6 +21,7 @@
 #include <mutex>
 #include <set>
 #include <sstream>
+#include <unordered_map>
 #include <utility>
 
 
@@ -182,6 +185,16 @@ PY_ULONG_LONG CPyCppyy::PyLongOrInt_AsULong64(PyObject* pyobject)
     return ull;
 }
 
+//----------------------------------------------------------------------------
+bool CPyCppyy::Utility::Compile(const std::string& code, bool silent)
+{
+// Compile the given code; as this may make new names available, scopes can no
+// longer rely on earlier failed lookups.
+    bool ok = Cppyy::Compile(code, silent);
+    InvalidateLookupCache();
+    return ok;
+}
+
 //----------------------------------------------------------------------------
 bool CPyCppyy::Utility::AddToClass(
     PyObject* pyclass, const char* label, PyCFunction cfunc, int flags)
@@ -618,6 +631,31 @@ static bool AddTypeName(std::string& tmpl_name, PyObject* tn, PyObject* arg,
     return false;
 }
 
+static bool AddTypeNameCached(std::string& tmpl_name, PyObject* tn)
+{
+// The name of a type used without an argument is fixed, so it is memoized for bound
+// classes and builtin types (held; other classes may be transient).
+    typedef std::unordered_map<PyObject*, std::string> TypeNames_t;
+    static TypeNames_t sTypeNames;
+
+    TypeNames_t::iterator name = sTypeNames.find(tn);
+    if (name != sTypeNames.end()) {
+        tmpl_name.append(name->second);
+        return true;
+    }
+
+    std::string tpname;
+    if (!AddTypeName(tpname, tn, nullptr, CPyCppyy::Utility::kNone))
+        return false;
+
+    if (CPyCppyy::CPPScope_Check(tn) || !(((PyTypeObject*)tn)->tp_flags & Py_TPFLAGS_HEAPTYPE)) {
+        Py_INCREF(tn);
+        sTypeNames[tn] = tpname;
+    }
+    tmpl_name.append(tpname);
+    return true;
+}
+
 std::string CPyCppyy::Utility::ConstructTemplateArgs(
     PyObject* pyname, PyObject* tpArgs, PyObject* args, ArgPreference pref, int argoff, int* pcnt)
 {
@@ -643,7 +681,10 @@ std::string CPyCppyy::Utility::ConstructTemplateArgs(
     // some common numeric types (separated out for performance: checking for
     // __cpp_name__ and/or __name__ is rather expensive)
         } else {
-            if (!AddTypeName(tmpl_name, tn, (args ? PyTuple_GET_ITEM(args, i) : nullptr), pref, pcnt)) {
+            PyObject* arg = args ? PyTuple_GET_ITEM(args, i) : nullptr;
+            bool added = (!arg && PyType_Check(tn)) ? \
+                AddTypeNameCached(tmpl_name, tn) : AddTypeName(tmpl_name, tn, arg, pref, pcnt);
+            if (!added) {
                 PyErr_SetString(PyExc_SyntaxError,
                     "could not construct C++ name from provided template argument.");
                 return "";
@@ -825,7 +866,7 @@ PyObject* CPyCppyy::Utility::FuncPtr2StdFunction(
              << retType << signature << "> " << fname.str()
              << "(intptr_t faddr) { return (" << retType << "(*)" << signature << ")faddr;} }";
 
-        if (!Cppyy::Compile(code.str())) {
+        if (!Utility::Compile(code.str())) {
             PyErr_SetString(PyExc_TypeError, "conversion to std::function failed");
             return nullptr;
         }
@@ -876,6 +917,65 @@ bool CPyCppyy::Utility::InitProxy(PyObject* module, PyTypeObject* pytype, const
     return true;
 }
 
+//----------------------------------------------------------------------------
+static Py_ssize_t GetDLPackBuffer(PyObject* pyobject, char tc, int size, void*& buf, bool check)
+{
+// Retrieve a linear buffer pointer from a DLPack capsule (or its producer) for
+// compact, row-major, CPU tensors. The capsule is not consumed: the memory is
+// kept alive by the argument object for the duration of the call.
+    using namespace CPyCppyy;
+
+    PyObject* capsule = pyobject;
+    if (PyCapsule_CheckExact(pyobject))
+        Py_INCREF(capsule);
+    else {
+        capsule = PyObject_CallMethodNoArgs(pyobject, PyStrings::gDLPack);
+        if (!capsule) {
+            PyErr_Clear();
+            return 0;
+        }
+    }
+
+    DLPack::DLManagedTensor* tensor = PyCapsule_IsValid(capsule, DLPack::kCapsuleName) ?
+        (DLPack::DLManagedTensor*)PyCapsule_GetPointer(capsule, DLPack::kCapsuleName) : nullptr;
+    if (!tensor) {
+        Py_DECREF(capsule);
+        return 0;
+    }
+
+    const DLPack::DLTensor& dl = tensor->dl_tensor;
+    Py_ssize_t buflen = 1;
+    int64_t expected = 1;
+    bool ok = dl.device.device_type == DLPack::kDLCPU && dl.dtype.lanes == 1;
+    for (int32_t idim = dl.ndim-1; ok && 0 <= idim; --idim) {
+        ok = !dl.strides || dl.shape[idim] == 1 || dl.strides[idim] == expected;
+        expected *= dl.shape[idim];
+        buflen *= (Py_ssize_t)dl.shape[idim];
+    }
+
+    if (ok && check && tc != '*') {
+    // match element type and size
+        int code = -1;
+        if (tc == '?')                   code = DLPack::kDLBool;
+        else if (strchr("bhilq", tc))    code = DLPack::kDLInt;
+        else if (strchr("BHILQ", tc))    code = DLPack::kDLUInt;
+        else if (strchr("fdg", tc))      code = DLPack::kDLFloat;
+        else if (tc == 'z' || tc == 'Z') code = DLPack::kDLComplex;
+        ok = dl.dtype.code == code && dl.dtype.bits == 8*size;
+        if (!ok) {
+            PyErr_Format(PyExc_TypeError,
+                "DLPack tensor type (code: %d, bits: %d) does not match needed (%c, %d bits)",
+                (int)dl.dtype.code, (int)dl.dtype.bits, tc, 8*size);
+        }
+    }
+
+    if (ok)
+        buf = (char*)dl.data + dl.byte_offset;
+
+    Py_DECREF(capsule);
+    return ok && buf ? buflen : 0;
+}
+
 //----------------------------------------------------------------------------
 Py_ssize_t CPyCppyy::Utility::GetBuffer(PyObject* pyobject, char tc, int size, void*& buf, bool check)
 {
@@ -938,6 +1038,11 @@ Py_ssize_t CPyCppyy::Utility::GetBuffer(PyObject* pyobject, char tc, int size, v
         PyErr_Clear();
     }
 
+// DLPack capsules and producers
+    if (PyCapsule_CheckExact(pyobject) ||
+            (!PyObject_CheckBuffer(pyobject) && _PyType_Lookup(Py_TYPE(pyobject), PyStrings::gDLPack)))
+        return GetDLPackBuffer(pyobject, tc, size, buf, check);
+
 // attempt to retrieve pointer through old-style buffer interface
     PyBufferProcs* bufprocs = Py_TYPE(pyobject)->tp_as_buffer;
 
@@ -1240,11 +1345,12 @@ bool CPyCppyy::Utility::IncludePython()
 {
 // setup Python API for callbacks
     if (!includesDone) {
-        bool okay = Cppyy::Compile(
+        bool okay = Utility::Compile(
         // basic API (converters etc.)
             "#include \"CPyCppyy/API.h\"\n"
 
         // utilities from the CPyCppyy public API
+            "#include \"CPyCppyy/DispatchCache.h\"\n"
             "#include \"CPyCppyy/DispatchPtr.h\"\n"
             "#include \"CPyCppyy/PyException.h\"\n"
         );
@@ -22,6 +22,9 @@ PY_ULONG_LONG PyLongOrInt_AsULong64(PyObject* pyobject);
 
 namespace Utility {
 
+// compile code, invalidating lookups that depend on what is loaded
+bool Compile(const std::string& code, bool silent = false);
+
 // convenience functions for adding methods to classes
 bool AddToClass(PyObject* pyclass, const char* label, PyCFunction cfunc,
     int flags = METH_VARARGS);